@@ -51,6 +51,7 @@ LOCAL_SRC_FILES := \
     upstream/parameter/BitParameterBlockType.cpp \
     upstream/parameter/ConfigurationAccessContext.cpp \
     upstream/parameter/BitwiseAreaConfiguration.cpp \
+    upstream/parameter/BlackboardComparator.cpp \
     upstream/parameter/ArrayParameter.cpp \
     upstream/parameter/ParameterBlackboard.cpp \
     upstream/parameter/InstanceConfigurableElement.cpp \
@@ -97,8 +98,16 @@ LOCAL_SRC_FILES := \
     upstream/parameter/ParameterAccessContext.cpp \
     upstream/parameter/XmlParameterSerializingContext.cpp \
     upstream/parameter/ElementHandle.cpp \
+    upstream/parameter/ParameterBatch.cpp \
     upstream/parameter/ParameterMgr.cpp \
+    upstream/parameter/ParameterMgrModel.cpp \
     upstream/parameter/SelectionCriterionType.cpp \
+    upstream/parameter/ImageFile.cpp \
+    upstream/parameter/RuntimeCheckpoint.cpp \
+    upstream/parameter/ScalarHandle.cpp \
+    upstream/parameter/SettingsImage.cpp \
+    upstream/parameter/StartupProfile.cpp \
+    upstream/parameter/StructureImage.cpp \
     upstream/parameter/Subsystem.cpp \
     upstream/parameter/IntegerParameterType.cpp \
     upstream/parameter/BitParameterType.cpp \
@@ -111,7 +120,10 @@ LOCAL_SRC_FILES := \
     upstream/xmlserializer/XmlElement.cpp \
     upstream/xmlserializer/XmlSerializingContext.cpp \
     upstream/xmlserializer/XmlMemoryDocSource.cpp \
+    upstream/xmlserializer/XmlReaderDocSource.cpp \
+    upstream/xmlserializer/XmlSchemaCache.cpp \
     upstream/xmlserializer/XmlDocSource.cpp \
+    upstream/xmlserializer/XmlDocPrefetcher.cpp \
     upstream/xmlserializer/XmlMemoryDocSink.cpp \
     upstream/xmlserializer/XmlStreamDocSink.cpp \
     upstream/parameter/CommandHandlerWrapper.cpp
@@ -133,7 +145,9 @@ common_copy_headers := \
     upstream/parameter/include/SelectionCriterionInterface.h \
     upstream/parameter/include/ParameterHandle.h \
     support/android/parameter/parameter_export.h \
-    upstream/parameter/include/ElementHandle.h
+    upstream/parameter/include/ElementHandle.h \
+    upstream/parameter/include/ParameterBatch.h \
+    upstream/parameter/include/ScalarHandle.h
 
 LOCAL_C_INCLUDES := $(LOCAL_EXPORT_C_INCLUDE_DIRS)
 
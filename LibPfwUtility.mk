@@ -37,12 +37,17 @@ LOCAL_MODULE_CLASS := STATIC_LIBRARIES
 LOCAL_SRC_FILES := \
     upstream/utility/DynamicLibrary.cpp \
     upstream/utility/posix/DynamicLibrary.cpp \
+    upstream/utility/Arena.cpp \
+    upstream/utility/BytesDiff.cpp \
+    upstream/utility/Compression.cpp \
+    upstream/utility/InternedString.cpp \
     upstream/utility/Tokenizer.cpp \
     upstream/utility/Utility.cpp
 
 target_copy_headers := \
     upstream/utility/NonCopyable.hpp \
     upstream/utility/ErrorContext.hpp \
+    upstream/utility/InternedString.h \
     upstream/utility/Utility.h \
     upstream/utility/convert.hpp
 
@@ -361,6 +361,26 @@ bool pfwSetStringParameter(PfwParameterHandler *handle, const char value[])
     return status.forward(handle->parameter.setAsString(value, status.msg()));
 }
 
+bool pfwSetParameters(PfwHandler *handle, const PfwParameterValue values[], size_t valueNb)
+{
+    Status &status = handle->lastStatus;
+    ParameterBatch batch;
+
+    for (size_t i = 0; i < valueNb; ++i) {
+        const PfwParameterValue &value = values[i];
+        if (&value.parameter->pfw != handle) {
+            return status.failure("Parameter value " + std::to_string(i) +
+                                  " is not a parameter of this pfw");
+        }
+        if (value.stringValue != NULL) {
+            batch.setAsString(value.parameter->parameter, value.stringValue);
+        } else {
+            batch.setAsSignedInteger(value.parameter->parameter, value.intValue);
+        }
+    }
+    return status.forward(batch.apply(status.msg()));
+}
+
 void pfwFree(void *ptr)
 {
     std::free(ptr);
@@ -278,6 +278,31 @@ bool pfwGetStringParameter(const PfwParameterHandler *handle, char *value[]) NON
 CPARAMETER_EXPORT
 bool pfwSetStringParameter(PfwParameterHandler *handle, const char value[]) NONNULL USERESULT;
 
+/** Value to set to a parameter, @see pfwSetParameters. */
+typedef struct
+{
+    /** Handler to a valid parameter of the pfw. */
+    PfwParameterHandler *parameter;
+    /** Null terminated value of a string parameter, NULL for an int parameter. */
+    const char *stringValue;
+    /** Value of an int parameter, ignored for a string parameter. */
+    int32_t intValue;
+} PfwParameterValue;
+
+/** Set the values of several parameters at once.
+  * The parameters are set under a single lock and each of their syncers
+  * is synchronized once, after all the sets.
+  * If a value can not be set, none of them is. If a synchronization fails,
+  * the previous values are restored and synchronized again.
+  * @param[in] handle @see PfwHandler
+  * @param[in] values An array of PfwParameterValue, applied in order.
+  * @param[in] valueNb The number of PfwParameterValue in values.
+  * @return true on success, false on failure.
+  */
+CPARAMETER_EXPORT
+bool pfwSetParameters(PfwHandler *handle, const PfwParameterValue values[],
+                      size_t valueNb) NONNULL USERESULT;
+
 /** Frees the memory space pointed to by ptr,
   *  which must have been returned by a previous call to the pfw.
   *
@@ -353,6 +353,39 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
 
                 pfwUnbindParameter(param);
             }
+
+            GIVEN ("Integer and string parameter handles") {
+                PfwParameterHandler *intParam = pfwBindParameter(pfw, intParameterPath);
+                REQUIRE_SUCCESS(intParam != NULL);
+                PfwParameterHandler *stringParam = pfwBindParameter(pfw, stringParameterPath);
+                REQUIRE_SUCCESS(stringParam != NULL);
+
+                WHEN ("Set parameters at once") {
+                    PfwParameterValue values[] = {{intParam, NULL, 12}, {stringParam, "ok", 0}};
+                    REQUIRE_SUCCESS(pfwSetParameters(pfw, values, 2));
+                    THEN ("Get parameters should return what was set") {
+                        char *stringValue;
+                        REQUIRE_SUCCESS(pfwGetIntParameter(intParam, &value));
+                        CHECK(value == 12);
+                        REQUIRE_SUCCESS(pfwGetStringParameter(stringParam, &stringValue));
+                        CHECK(stringValue == std::string("ok"));
+                        pfwFree(stringValue);
+                    }
+                }
+                WHEN ("Set parameters at once, one being out of range") {
+                    REQUIRE_SUCCESS(pfwSetIntParameter(intParam, 1));
+                    PfwParameterValue values[] = {{intParam, NULL, 12},
+                                                  {stringParam, "ko_1234567", 0}};
+                    REQUIRE_FAILURE(pfwSetParameters(pfw, values, 2));
+                    THEN ("No parameter should have been set") {
+                        REQUIRE_SUCCESS(pfwGetIntParameter(intParam, &value));
+                        CHECK(value == 1);
+                    }
+                }
+
+                pfwUnbindParameter(stringParam);
+                pfwUnbindParameter(intParam);
+            }
         }
 
         pfwDestroy(pfw);
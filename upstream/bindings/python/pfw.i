@@ -44,6 +44,7 @@
     catch (Swig::DirectorException &e) { SWIG_fail; }
 }
 
+%include "stdint.i"
 %include "std_string.i"
 %include "std_vector.i"
 %include "typemaps.i"
@@ -88,6 +89,10 @@ public:
     // Configuration application
     void applyConfigurations();
 
+    // Parameter modification polling
+    uint64_t getEpoch() const;
+    std::vector<std::string> getChangedSince(uint64_t epoch) const;
+
     bool getForceNoRemoteInterface() const;
     void setForceNoRemoteInterface(bool bForceNoRemoteInterface);
 
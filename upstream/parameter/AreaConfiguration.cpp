@@ -52,6 +52,9 @@ CAreaConfiguration::CAreaConfiguration(const CConfigurableElement *pConfigurable
 void CAreaConfiguration::save(const CParameterBlackboard *pMainBlackboard)
 {
     copyFrom(pMainBlackboard, _pConfigurableElement->getOffset());
+
+    // Settings are only edited occasionally, store them once among identical ones
+    _blackboard.share();
 }
 
 // Apply data to current
@@ -98,11 +101,31 @@ void CAreaConfiguration::validateAgainst(const CAreaConfiguration *pValidAreaCon
 
     // Copy
     _blackboard.restoreFrom(&pValidAreaConfiguration->_blackboard, 0);
+    _blackboard.share();
 
     // Set as valid
     _bValid = true;
 }
 
+// Update from an area configuration of another domain
+bool CAreaConfiguration::updateFrom(const CAreaConfiguration &validAreaConfiguration)
+{
+    assert(validAreaConfiguration.isValid());
+    assert(_pConfigurableElement == validAreaConfiguration._pConfigurableElement);
+
+    if (_bValid && _blackboard.diff(validAreaConfiguration._blackboard, 0, 0,
+                                    _blackboard.getSize()).empty()) {
+
+        return false;
+    }
+    _blackboard.restoreFrom(&validAreaConfiguration._blackboard, 0);
+    _blackboard.share();
+
+    _bValid = true;
+
+    return true;
+}
+
 // XML configuration settings parsing
 bool CAreaConfiguration::serializeXmlSettings(
     CXmlElement &xmlConfigurableElementSettingsElementContent,
@@ -122,12 +145,52 @@ bool CAreaConfiguration::serializeXmlSettings(
 
             // Serialized-in areas are valid
             _bValid = true;
+
+            _blackboard.share();
         }
         return true;
     }
     return false;
 }
 
+bool CAreaConfiguration::setRawSettings(const uint8_t *settings, size_t size, std::string &error)
+{
+    if (!checkRawSettingsSize(size, error)) {
+
+        return false;
+    }
+    _blackboard.writeBuffer(settings, size, 0);
+    _blackboard.share();
+
+    _bValid = true;
+
+    return true;
+}
+
+bool CAreaConfiguration::deferRawSettings(size_t size, bool bValid, std::string &error)
+{
+    if (bValid && !checkRawSettingsSize(size, error)) {
+
+        return false;
+    }
+    _blackboard.setSize(0);
+
+    _bValid = bValid;
+
+    return true;
+}
+
+bool CAreaConfiguration::checkRawSettingsSize(size_t size, std::string &error) const
+{
+    if (size != _blackboard.getSize()) {
+
+        error = "Wrong settings size for " + _pConfigurableElement->getPath() + ": expected " +
+                std::to_string(_blackboard.getSize()) + " bytes, got " + std::to_string(size);
+        return false;
+    }
+    return true;
+}
+
 // Compound handling
 const CConfigurableElement *CAreaConfiguration::getConfigurableElement() const
 {
@@ -141,6 +204,8 @@ void CAreaConfiguration::copyToOuter(CAreaConfiguration *pToAreaConfiguration) c
     copyTo(&pToAreaConfiguration->_blackboard,
            _pConfigurableElement->getOffset() -
                pToAreaConfiguration->getConfigurableElement()->getOffset());
+
+    pToAreaConfiguration->_blackboard.share();
 }
 
 void CAreaConfiguration::copyFromOuter(const CAreaConfiguration *pFromAreaConfiguration)
@@ -150,6 +215,7 @@ void CAreaConfiguration::copyFromOuter(const CAreaConfiguration *pFromAreaConfig
     copyFrom(&pFromAreaConfiguration->_blackboard,
              _pConfigurableElement->getOffset() -
                  pFromAreaConfiguration->getConfigurableElement()->getOffset());
+    _blackboard.share();
 
     // Inner becomes valid
     setValid(true);
@@ -66,6 +66,15 @@ public:
     // Ensure validity against given valid area configuration
     void validateAgainst(const CAreaConfiguration *pValidAreaConfiguration);
 
+    /** Take the settings of a valid area configuration of the same element, if they differ
+     *
+     * The other area configuration may belong to another domain, such as a reloaded one.
+     *
+     * @param[in] validAreaConfiguration the area configuration to update from
+     * @return true if the settings changed, false if they were already the same
+     */
+    bool updateFrom(const CAreaConfiguration &validAreaConfiguration);
+
     // Compound handling
     const CConfigurableElement *getConfigurableElement() const;
 
@@ -79,6 +88,27 @@ public:
     bool serializeXmlSettings(CXmlElement &xmlConfigurableElementSettingsElementContent,
                               CConfigurationAccessContext &configurationAccessContext);
 
+    /** Set the settings from their raw blackboard content, making the area configuration valid
+     *
+     * @param[in] settings the settings, laid out as in the configuration blackboard
+     * @param[in] size the size of the settings, must match the configuration blackboard one
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    bool setRawSettings(const uint8_t *settings, size_t size, std::string &error);
+
+    /** Release the settings until they are set by setRawSettings, setting the validity now
+     *
+     * The blackboard is emptied, it must be given back its size before setting the settings.
+     *
+     * @param[in] size the size of the settings to come, must match the configuration blackboard
+     *                 one if the area configuration is valid
+     * @param[in] bValid the validity of the settings to come
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    bool deferRawSettings(size_t size, bool bValid, std::string &error);
+
     // Fetch the Configuration Blackboard
     CParameterBlackboard &getBlackboard();
     const CParameterBlackboard &getBlackboard() const;
@@ -95,6 +125,9 @@ private:
     // Store validity
     void setValid(bool bValid);
 
+    // Raw settings size checking
+    bool checkRawSettingsSize(size_t size, std::string &error) const;
+
 protected:
     // Associated configurable element
     const CConfigurableElement *_pConfigurableElement;
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "BitParameterBlockType.h"
+#include "ImageFile.h"
 #include "BitParameterBlock.h"
 #include "Utility.h"
 
@@ -67,10 +68,29 @@ bool CBitParameterBlockType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CBitParameterBlockType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt64(_size);
+}
+
+bool CBitParameterBlockType::propertiesFromImage(CImageReader &reader,
+                                                 const CComponentLibrary &componentLibrary,
+                                                 std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _size = static_cast<size_t>(reader.readUInt64());
+    return true;
+}
+
 // Instantiation
-CInstanceConfigurableElement *CBitParameterBlockType::doInstantiate() const
+CInstanceConfigurableElement *CBitParameterBlockType::doInstantiate(utility::Arena &arena) const
 {
-    return new CBitParameterBlock(getName(), this);
+    return new (arena) CBitParameterBlock(getName(), this);
 }
 
 // From IXmlSource
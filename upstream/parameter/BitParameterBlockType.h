@@ -44,6 +44,11 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
@@ -53,7 +58,7 @@ public:
 private:
     virtual bool childrenAreDynamic() const;
     // Instantiation
-    virtual CInstanceConfigurableElement *doInstantiate() const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
 
     // Size in bytes
     size_t _size{0};
@@ -28,12 +28,14 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "BitParameterType.h"
+#include "ImageFile.h"
 #include "BitParameter.h"
 #include <stdlib.h>
 #include <sstream>
 #include "ParameterAccessContext.h"
 #include "BitParameterBlockType.h"
 #include "Utility.h"
+#include "convert.hpp"
 
 #define base CTypeElement
 
@@ -118,6 +120,29 @@ bool CBitParameterType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CBitParameterType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt64(_bitPos);
+    writer.writeUInt64(_uiBitSize);
+    writer.writeUInt64(_uiMax);
+}
+
+bool CBitParameterType::propertiesFromImage(CImageReader &reader,
+                                            const CComponentLibrary &componentLibrary,
+                                            std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _bitPos = static_cast<size_t>(reader.readUInt64());
+    _uiBitSize = static_cast<size_t>(reader.readUInt64());
+    _uiMax = reader.readUInt64();
+    return true;
+}
+
 // Conversion
 bool CBitParameterType::toBlackboard(const string &strValue, uint64_t &uiValue,
                                      CParameterAccessContext &parameterAccessContext) const
@@ -158,18 +183,14 @@ void CBitParameterType::fromBlackboard(string &strValue, const uint64_t &uiValue
 {
     uint64_t uiConvertedValue = (uiValue & getMask()) >> _bitPos;
 
-    // Format
-    std::ostringstream strStream;
-
     // Take care of format
     if (parameterAccessContext.valueSpaceIsRaw() && parameterAccessContext.outputRawFormatIsHex()) {
 
-        strStream << "0x" << std::hex << std::uppercase;
-    }
-
-    strStream << uiConvertedValue;
+        strValue = toHexString(uiConvertedValue);
+    } else {
 
-    strValue = strStream.str();
+        strValue = std::to_string(uiConvertedValue);
+    }
 }
 
 // Value access
@@ -208,9 +229,9 @@ size_t CBitParameterType::getBitSize() const
     return _uiBitSize;
 }
 
-CInstanceConfigurableElement *CBitParameterType::doInstantiate() const
+CInstanceConfigurableElement *CBitParameterType::doInstantiate(utility::Arena &arena) const
 {
-    return new CBitParameter(getName(), this);
+    return new (arena) CBitParameter(getName(), this);
 }
 
 // Max value
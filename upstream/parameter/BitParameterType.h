@@ -46,6 +46,11 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
     /// Conversion
@@ -80,7 +85,7 @@ public:
     size_t getBitPos() const { return _bitPos; }
 private:
     // Instantiation
-    virtual CInstanceConfigurableElement *doInstantiate() const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
     // Max encodable value
     uint64_t getMaxEncodableValue() const;
     // Biwise mask
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BlackboardComparator.h"
+#include "BitParameter.h"
+#include "ConfigurableElement.h"
+#include "ParameterBlackboard.h"
+
+#include <algorithm>
+
+CBlackboardComparator::CBlackboardComparator(const CParameterBlackboard &blackboard,
+                                             const CParameterBlackboard &otherBlackboard,
+                                             size_t baseOffset)
+    : mBlackboard(blackboard), mOtherBlackboard(otherBlackboard), mBaseOffset(baseOffset)
+{
+}
+
+void CBlackboardComparator::listDifferingParameters(const CConfigurableElement &element,
+                                                    std::vector<std::string> &paths) const
+{
+    size_t offset = element.getOffset() - mBaseOffset;
+
+    Spans spans = mBlackboard.diff(mOtherBlackboard, offset, offset, getCoveredSize(element));
+
+    // Make spans relative to the blackboards start, as element offsets are
+    for (auto &span : spans) {
+        span.offset += offset;
+    }
+    appendParameters(element, mBaseOffset, spans, this, paths);
+}
+
+void CBlackboardComparator::listOverlappingParameters(const CConfigurableElement &element,
+                                                      size_t baseOffset, const Spans &spans,
+                                                      std::vector<std::string> &paths)
+{
+    appendParameters(element, baseOffset, spans, nullptr, paths);
+}
+
+void CBlackboardComparator::appendParameters(const CConfigurableElement &element,
+                                             size_t baseOffset, const Spans &spans,
+                                             const CBlackboardComparator *comparator,
+                                             std::vector<std::string> &paths)
+{
+    size_t offset = element.getOffset() - baseOffset;
+
+    // First span not ending before the element
+    auto span = std::lower_bound(begin(spans), end(spans), offset,
+                                 [](const utility::BytesSpan &span, size_t offset) {
+                                     return span.offset + span.size <= offset;
+                                 });
+    if (span == end(spans) || span->offset >= offset + getCoveredSize(element)) {
+
+        return;
+    }
+    auto bitParameter = dynamic_cast<const CBitParameter *>(&element);
+
+    if (bitParameter != nullptr && comparator != nullptr) {
+
+        // Bit parameters share their bytes, compare their own bits
+        uint64_t data = 0;
+        uint64_t otherData = 0;
+        size_t size = bitParameter->getBelongingBlockSize();
+        comparator->mBlackboard.readInteger(&data, size, offset);
+        comparator->mOtherBlackboard.readInteger(&otherData, size, offset);
+
+        if (bitParameter->merge(data, otherData) == data) {
+
+            return;
+        }
+    }
+    size_t nbChildren = element.getNbChildren();
+
+    if (nbChildren == 0) {
+
+        paths.push_back(element.getPath());
+        return;
+    }
+    for (size_t child = 0; child < nbChildren; child++) {
+
+        appendParameters(*static_cast<const CConfigurableElement *>(element.getChild(child)),
+                         baseOffset, spans, comparator, paths);
+    }
+}
+
+size_t CBlackboardComparator::getCoveredSize(const CConfigurableElement &element)
+{
+    // Bit parameters have no footprint of their own
+    auto bitParameter = dynamic_cast<const CBitParameter *>(&element);
+
+    return bitParameter != nullptr ? bitParameter->getBelongingBlockSize()
+                                   : element.getFootPrint();
+}
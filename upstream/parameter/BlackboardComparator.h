@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "BytesDiff.h"
+
+#include <string>
+#include <vector>
+
+class CConfigurableElement;
+class CParameterBlackboard;
+
+/** Lists the parameters whose values differ between two blackboards of the same layout */
+class CBlackboardComparator
+{
+public:
+    using Spans = std::vector<utility::BytesSpan>;
+
+    /**
+     * @param[in] blackboard the first compared blackboard
+     * @param[in] otherBlackboard the second compared blackboard
+     * @param[in] baseOffset the offset in the main blackboard where both blackboards start
+     */
+    CBlackboardComparator(const CParameterBlackboard &blackboard,
+                          const CParameterBlackboard &otherBlackboard, size_t baseOffset);
+
+    /** List the parameters of an element subtree whose values differ
+     *
+     * @param[in] element the root of the compared subtree
+     * @param[out] paths the paths of the differing parameters, appended in tree order
+     */
+    void listDifferingParameters(const CConfigurableElement &element,
+                                 std::vector<std::string> &paths) const;
+
+    /** List the parameters of an element subtree overlapping spans of bytes
+     *
+     * @param[in] element the root of the subtree
+     * @param[in] baseOffset the offset in the main blackboard the spans are relative to
+     * @param[in] spans the spans of bytes, in increasing offset order
+     * @param[out] paths the paths of the overlapping parameters, appended in tree order
+     */
+    static void listOverlappingParameters(const CConfigurableElement &element, size_t baseOffset,
+                                          const Spans &spans, std::vector<std::string> &paths);
+
+private:
+    /** Walk the parts of a subtree overlapping spans of bytes
+     *
+     * @param[in] element the element to inspect
+     * @param[in] baseOffset the offset in the main blackboard the spans are relative to
+     * @param[in] spans the spans of bytes, in increasing offset order
+     * @param[in] comparator if not null, the comparator checking the bits of bit parameters
+     * @param[out] paths the paths of the overlapping parameters
+     */
+    static void appendParameters(const CConfigurableElement &element, size_t baseOffset,
+                                 const Spans &spans, const CBlackboardComparator *comparator,
+                                 std::vector<std::string> &paths);
+
+    /** @return the number of bytes holding the element, including for bit parameters */
+    static size_t getCoveredSize(const CConfigurableElement &element);
+
+    const CParameterBlackboard &mBlackboard;
+    const CParameterBlackboard &mOtherBlackboard;
+    const size_t mBaseOffset;
+};
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ComponentInstance.h"
+#include "ImageFile.h"
 #include "ComponentLibrary.h"
 #include "ComponentType.h"
 #include "Component.h"
@@ -109,16 +110,43 @@ bool CComponentInstance::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
-CInstanceConfigurableElement *CComponentInstance::doInstantiate() const
+// Structure image
+void CComponentInstance::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeString(_pComponentType->getName());
+}
+
+bool CComponentInstance::propertiesFromImage(CImageReader &reader,
+                                             const CComponentLibrary &componentLibrary,
+                                             std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    std::string strComponentType = reader.readString();
+
+    _pComponentType = componentLibrary.getComponentType(strComponentType);
+
+    if (!_pComponentType) {
+
+        error = "ComponentType " + strComponentType + " of Component " + getName() + " not found";
+        return false;
+    }
+    return true;
+}
+
+CInstanceConfigurableElement *CComponentInstance::doInstantiate(utility::Arena &arena) const
 {
     if (isScalar()) {
-        return new CComponent(getName(), this);
+        return new (arena) CComponent(getName(), this);
     } else {
-        return new CParameterBlock(getName(), this);
+        return new (arena) CParameterBlock(getName(), this);
     }
 }
 
-void CComponentInstance::populate(CElement *pElement) const
+void CComponentInstance::populate(CElement *pElement, utility::Arena &arena) const
 {
     size_t arrayLength = getArrayLength();
 
@@ -127,17 +155,17 @@ void CComponentInstance::populate(CElement *pElement) const
         // Create child elements
         for (size_t child = 0; child < arrayLength; child++) {
 
-            CComponent *pChildComponent = new CComponent(std::to_string(child), this);
+            CComponent *pChildComponent = new (arena) CComponent(std::to_string(child), this);
 
             pElement->addChild(pChildComponent);
 
-            base::populate(pChildComponent);
+            base::populate(pChildComponent, arena);
 
-            _pComponentType->populate(pChildComponent);
+            _pComponentType->populate(pChildComponent, arena);
         }
     } else {
-        base::populate(pElement);
+        base::populate(pElement, arena);
 
-        _pComponentType->populate(static_cast<CComponent *>(pElement));
+        _pComponentType->populate(static_cast<CComponent *>(pElement), arena);
     }
 }
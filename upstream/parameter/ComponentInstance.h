@@ -53,14 +53,19 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // CElement
     virtual std::string getKind() const;
     std::string getXmlElementName() const override;
 
 private:
     virtual bool childrenAreDynamic() const;
-    virtual CInstanceConfigurableElement *doInstantiate() const;
-    virtual void populate(CElement *pElement) const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
+    virtual void populate(CElement *pElement, utility::Arena &arena) const;
 
     // Related component type
     const CComponentType *_pComponentType{nullptr};
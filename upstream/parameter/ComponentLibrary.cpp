@@ -43,7 +43,16 @@ std::string CComponentLibrary::getKind() const
 
 const CComponentType *CComponentLibrary::getComponentType(const std::string &strName) const
 {
-    return static_cast<const CComponentType *>(findChild(strName));
+    // Index the types added since the last lookup, the first of a name prevails as in findChild
+    for (; _nbIndexedComponentTypes < getNbChildren(); _nbIndexedComponentTypes++) {
+
+        const CElement *pChild = getChild(_nbIndexedComponentTypes);
+        _componentTypeIndex.emplace(pChild->getName(),
+                                    static_cast<const CComponentType *>(pChild));
+    }
+    auto componentType = _componentTypeIndex.find(strName);
+
+    return componentType != _componentTypeIndex.end() ? componentType->second : nullptr;
 }
 
 bool CComponentLibrary::fromXml(const CXmlElement &xmlElement,
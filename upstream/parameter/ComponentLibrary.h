@@ -34,6 +34,7 @@
 #include "Component.h"
 
 #include <string>
+#include <unordered_map>
 
 class CComponentType;
 
@@ -49,4 +50,12 @@ public:
 
 private:
     virtual bool childrenAreDynamic() const;
+
+    /** Component types by name, indexed on lookup as the library is being built
+     *
+     * Types are only looked up while building, hence no locking.
+     */
+    mutable std::unordered_map<std::string, const CComponentType *> _componentTypeIndex;
+    /** Number of children already in _componentTypeIndex */
+    mutable size_t _nbIndexedComponentTypes{0};
 };
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ComponentType.h"
+#include "ImageFile.h"
 #include "ComponentLibrary.h"
 #include "TypeElement.h"
 #include "XmlParameterSerializingContext.h"
@@ -111,20 +112,52 @@ bool CComponentType::fromXml(const CXmlElement &xmlElement,
     return true;
 }
 
-void CComponentType::populate(CElement *pElement) const
+// Structure image
+void CComponentType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeString(_pExtendsComponentType != nullptr ? _pExtendsComponentType->getName()
+                                                         : "");
+}
+
+bool CComponentType::propertiesFromImage(CImageReader &reader,
+                                         const CComponentLibrary &componentLibrary,
+                                         std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    std::string strExtendsType = reader.readString();
+
+    if (!strExtendsType.empty()) {
+
+        _pExtendsComponentType = componentLibrary.getComponentType(strExtendsType);
+
+        if (!_pExtendsComponentType) {
+
+            error = "ComponentType " + strExtendsType + " referred to by " + getName() +
+                    " not found";
+            return false;
+        }
+    }
+    return true;
+}
+
+void CComponentType::populate(CElement *pElement, utility::Arena &arena) const
 {
     // Populate children
-    base::populate(pElement);
+    base::populate(pElement, arena);
 
     // Manage extended type
     if (_pExtendsComponentType) {
 
         // Populate from extended type
-        _pExtendsComponentType->populate(pElement);
+        _pExtendsComponentType->populate(pElement, arena);
     }
 }
 
-CInstanceConfigurableElement *CComponentType::doInstantiate() const
+CInstanceConfigurableElement *CComponentType::doInstantiate(utility::Arena & /*arena*/) const
 {
     // Not supposed to be called directly (instantiation made through CComponentInstance object)
     assert(0);
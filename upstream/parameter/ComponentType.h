@@ -41,7 +41,7 @@ public:
     CComponentType(const std::string &strName);
 
     // Object creation
-    virtual void populate(CElement *pElement) const;
+    virtual void populate(CElement *pElement, utility::Arena &arena) const;
 
     // Mapping info
     virtual bool getMappingData(const std::string &strKey, const std::string *&pStrValue) const;
@@ -55,6 +55,12 @@ public:
 
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
+
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // CElement
     virtual std::string getKind() const;
 
@@ -62,7 +68,7 @@ private:
     // CElement
     virtual bool childrenAreDynamic() const;
     // Component creation
-    virtual CInstanceConfigurableElement *doInstantiate() const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
 
     // Ref
     const CComponentType *_pExtendsComponentType{nullptr};
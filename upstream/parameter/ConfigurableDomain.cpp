@@ -34,6 +34,8 @@
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainImportContext.h"
 #include "XmlDomainExportContext.h"
+#include "ImageFile.h"
+#include "SystemClass.h"
 #include "Utility.h"
 #include "AlwaysAssert.hpp"
 #include <cassert>
@@ -360,6 +362,110 @@ bool CConfigurableDomain::parseSettings(const CXmlElement &xmlElement,
 
     return true;
 }
+// Settings image composing
+void CConfigurableDomain::toImage(CImageWriter &writer) const
+{
+    writer.writeString(getName());
+    writer.writeUInt8(_bSequenceAware);
+
+    // Configurable elements
+    writer.writeUInt32(static_cast<uint32_t>(_configurableElementList.size()));
+
+    for (const CConfigurableElement *pConfigurableElement : _configurableElementList) {
+
+        writer.writeString(pConfigurableElement->getPath());
+    }
+
+    // Configurations
+    size_t uiNbConfigurations = getNbChildren();
+    writer.writeUInt32(static_cast<uint32_t>(uiNbConfigurations));
+
+    for (size_t child = 0; child < uiNbConfigurations; child++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(child));
+
+        writer.writeString(pDomainConfiguration->getName());
+        pDomainConfiguration->toImage(writer);
+    }
+}
+
+// Settings image parsing
+bool CConfigurableDomain::fromImage(CImageReader &reader, CSystemClass &systemClass,
+                                    const CSelectionCriteriaDefinition *criteriaDefinition,
+                                    string &strError)
+{
+    // We're supposedly clean
+    assert(_configurableElementList.empty());
+
+    setName(reader.readString());
+    _bSequenceAware = reader.readUInt8() != 0;
+
+    // Configurable elements, associated before the configurations are created
+    size_t uiNbConfigurableElements = reader.readUInt32();
+
+    for (size_t element = 0; element < uiNbConfigurableElements && !reader.hasFailed();
+         element++) {
+
+        string strConfigurableElementPath = reader.readString();
+        CPathNavigator pathNavigator(strConfigurableElementPath);
+
+        CConfigurableElement *pConfigurableElement = NULL;
+        if (pathNavigator.navigateThrough(systemClass.getName(), strError)) {
+
+            pConfigurableElement =
+                static_cast<CConfigurableElement *>(systemClass.findDescendant(pathNavigator));
+        }
+        if (!pConfigurableElement) {
+
+            strError = "Could not find configurable element of path " +
+                       strConfigurableElementPath + " from ConfigurableDomain " + getName();
+            return false;
+        }
+        core::Results infos;
+        if (!addConfigurableElement(pConfigurableElement, NULL, infos)) {
+
+            strError = utility::asString(infos);
+            return false;
+        }
+    }
+
+    // Configurations
+    size_t uiNbConfigurations = reader.readUInt32();
+
+    for (size_t configuration = 0; configuration < uiNbConfigurations && !reader.hasFailed();
+         configuration++) {
+
+        string strName = reader.readString();
+
+        if (findChild(strName)) {
+
+            strError = "Duplicate configuration " + strName + " in ConfigurableDomain " +
+                       getName();
+            return false;
+        }
+        CDomainConfiguration *pDomainConfiguration = new CDomainConfiguration(strName);
+
+        for (const CConfigurableElement *pConfigurableElement : _configurableElementList) {
+
+            pDomainConfiguration->addConfigurableElement(pConfigurableElement,
+                                                         getSyncerSet(pConfigurableElement));
+        }
+        addChild(pDomainConfiguration);
+
+        if (!pDomainConfiguration->fromImage(reader, criteriaDefinition, strError)) {
+
+            return false;
+        }
+    }
+
+    // Same as when importing XML settings: settings missing from the image are taken from the
+    // other configurations when possible
+    autoValidateAll();
+
+    return true;
+}
+
 // Configurable elements association
 bool CConfigurableDomain::addConfigurableElement(CConfigurableElement *pConfigurableElement,
                                                  const CParameterBlackboard *pMainBlackboard,
@@ -791,6 +897,32 @@ bool CConfigurableDomain::getElementSequence(const string &strConfiguration,
     return true;
 }
 
+bool CConfigurableDomain::listDifferingParameters(const string &strConfiguration,
+                                                  const string &strOtherConfiguration,
+                                                  string &strResult) const
+{
+    // Find Domain configurations
+    const CDomainConfiguration *pDomainConfiguration =
+        findConfiguration(strConfiguration, strResult);
+
+    if (!pDomainConfiguration) {
+
+        return false;
+    }
+    const CDomainConfiguration *pOtherDomainConfiguration =
+        findConfiguration(strOtherConfiguration, strResult);
+
+    if (!pOtherDomainConfiguration) {
+
+        return false;
+    }
+
+    // Delegate to configuration
+    pDomainConfiguration->listDifferingParameters(*pOtherDomainConfiguration, strResult);
+
+    return true;
+}
+
 bool CConfigurableDomain::setApplicationRule(
     const string &strConfiguration, const string &strApplicationRule,
     const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition, string &strError)
@@ -852,6 +984,29 @@ string CConfigurableDomain::getLastAppliedConfigurationName() const
     return "<none>";
 }
 
+const CDomainConfiguration *CConfigurableDomain::getLastAppliedConfiguration() const
+{
+    return _pLastAppliedConfiguration;
+}
+
+bool CConfigurableDomain::setLastAppliedConfiguration(const string &configurationName,
+                                                      string &strError)
+{
+    if (configurationName.empty()) {
+
+        _pLastAppliedConfiguration = NULL;
+        return true;
+    }
+    const CDomainConfiguration *configuration = findConfiguration(configurationName, strError);
+
+    if (configuration == NULL) {
+
+        return false;
+    }
+    _pLastAppliedConfiguration = configuration;
+    return true;
+}
+
 // Pending configuration
 string CConfigurableDomain::getPendingConfigurationName() const
 {
@@ -876,6 +1031,63 @@ string CConfigurableDomain::getPendingConfigurationName() const
     }
 }
 
+// Reloading
+bool CConfigurableDomain::updateFrom(CConfigurableDomain &reloaded, core::Results &infos)
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    if (_bSequenceAware != reloaded._bSequenceAware ||
+        _configurableElementList != reloaded._configurableElementList ||
+        uiNbConfigurations != reloaded.getNbChildren()) {
+
+        return false;
+    }
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+        const CDomainConfiguration *pReloadedConfiguration =
+            static_cast<const CDomainConfiguration *>(reloaded.getChild(uiChild));
+
+        string strSequence;
+        string strReloadedSequence;
+        pDomainConfiguration->getElementSequence(strSequence);
+        pReloadedConfiguration->getElementSequence(strReloadedSequence);
+
+        if (pDomainConfiguration->getName() != pReloadedConfiguration->getName() ||
+            strSequence != strReloadedSequence) {
+
+            return false;
+        }
+    }
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        CDomainConfiguration *pDomainConfiguration =
+            static_cast<CDomainConfiguration *>(getChild(uiChild));
+
+        bool bRuleChanged;
+        bool bSettingsChanged = pDomainConfiguration->updateFrom(
+            *static_cast<CDomainConfiguration *>(reloaded.getChild(uiChild)), bRuleChanged);
+
+        if (bRuleChanged) {
+
+            infos.push_back("Updated the rule of configuration " + pDomainConfiguration->getPath());
+        }
+        if (bSettingsChanged) {
+
+            infos.push_back("Updated the settings of configuration " +
+                            pDomainConfiguration->getPath());
+
+            if (pDomainConfiguration == _pLastAppliedConfiguration) {
+
+                // Have it applied again
+                _pLastAppliedConfiguration = nullptr;
+            }
+        }
+    }
+    return true;
+}
+
 // Ensure validity on whole domain from main blackboard
 void CConfigurableDomain::validate(const CParameterBlackboard *pMainBlackboard)
 {
@@ -892,6 +1104,51 @@ void CConfigurableDomain::validate(const CParameterBlackboard *pMainBlackboard)
     }
 }
 
+// Settings memory accounting
+void CConfigurableDomain::accountSettingsMemory(SSettingsMemoryUsage &usage) const
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->accountSettingsMemory(usage);
+    }
+}
+
+// Settings compression
+void CConfigurableDomain::compressIdleConfigurations(std::chrono::milliseconds idleDelay)
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        CDomainConfiguration *pDomainConfiguration =
+            static_cast<CDomainConfiguration *>(getChild(uiChild));
+
+        if (pDomainConfiguration != _pLastAppliedConfiguration) {
+
+            pDomainConfiguration->compressIfIdle(idleDelay);
+        }
+    }
+}
+
+// Lazy settings loading
+void CConfigurableDomain::materializeConfigurations() const
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->materialize();
+    }
+}
+
 // Ensure validity on areas related to configurable element
 void CConfigurableDomain::validateAreas(const CConfigurableElement *pConfigurableElement,
                                         const CParameterBlackboard *pMainBlackboard)
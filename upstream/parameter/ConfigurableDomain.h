@@ -34,6 +34,8 @@
 #include "XmlDomainExportContext.h"
 #include "SyncerSet.h"
 #include "Results.h"
+#include "SettingsMemoryUsage.h"
+#include <chrono>
 #include <list>
 #include <set>
 #include <map>
@@ -43,6 +45,9 @@ class CConfigurableElement;
 class CDomainConfiguration;
 class CParameterBlackboard;
 class CSelectionCriteriaDefinition;
+class CSystemClass;
+class CImageWriter;
+class CImageReader;
 
 class CConfigurableDomain : public CElement
 {
@@ -84,6 +89,9 @@ public:
                             const std::vector<std::string> &astrNewElementSequence,
                             std::string &strError);
     bool getElementSequence(const std::string &strConfiguration, std::string &strResult) const;
+    bool listDifferingParameters(const std::string &strConfiguration,
+                                 const std::string &strOtherConfiguration,
+                                 std::string &strResult) const;
     bool setApplicationRule(const std::string &strConfiguration,
                             const std::string &strApplicationRule,
                             const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
@@ -94,6 +102,19 @@ public:
     // Last applied configuration name
     std::string getLastAppliedConfigurationName() const;
 
+    // Last applied configuration, NULL if none
+    const CDomainConfiguration *getLastAppliedConfiguration() const;
+
+    /** Record a configuration as the last applied one without restoring it, the main
+     * blackboard and the hardware being known to hold its settings already
+     *
+     * @param[in] configurationName the configuration name, empty for none
+     * @param[out] strError human readable error
+     * @return false if there is no such configuration, true otherwise
+     */
+    bool setLastAppliedConfiguration(const std::string &configurationName,
+                                     std::string &strError);
+
     // Pending configuration name
     std::string getPendingConfigurationName() const;
 
@@ -132,6 +153,32 @@ public:
     // Ensure validity on whole domain from main blackboard
     void validate(const CParameterBlackboard *pMainBlackboard);
 
+    /** Take the rules and the settings of the same domain read again from the settings
+     *
+     * A configuration whose settings change is applied again, even if it stays selected.
+     *
+     * @param[in,out] reloaded the reloaded domain, whose changed rules are taken
+     * @param[out] infos what changed in the domain
+     * @return true if updated, false if the elements, the configurations or their element
+     *         sequences differ: the domain then has to be replaced by the reloaded one
+     */
+    bool updateFrom(CConfigurableDomain &reloaded, core::Results &infos);
+
+    // Settings memory accounting
+    void accountSettingsMemory(SSettingsMemoryUsage &usage) const;
+
+    /** Compress the settings of the configurations that have not been restored for a while
+     *
+     * The last applied configuration is never compressed.
+     *
+     * @param[in] idleDelay the time after which settings that have not been restored are
+     *                      compressed
+     */
+    void compressIdleConfigurations(std::chrono::milliseconds idleDelay);
+
+    // Copy the configuration settings still in the settings image, if any
+    void materializeConfigurations() const;
+
     /** Apply the configuration if required
      *
      * @param[in] pParameterBlackboard the blackboard to synchronize
@@ -153,6 +200,20 @@ public:
     virtual void childrenToXml(CXmlElement &xmlElement,
                                CXmlSerializingContext &serializingContext) const;
 
+    // Settings image composing
+    void toImage(CImageWriter &writer) const;
+
+    /** Read the domain, its elements and its configurations from a settings image
+     *
+     * @param[in] reader the settings image payload
+     * @param[in] systemClass the structure the domain elements belong to
+     * @param[in] criteriaDefinition the criteria the configuration rules refer to
+     * @param[out] strError human readable error
+     * @return true on success, false otherwise
+     */
+    bool fromImage(CImageReader &reader, CSystemClass &systemClass,
+                   const CSelectionCriteriaDefinition *criteriaDefinition, std::string &strError);
+
     // Class kind
     virtual std::string getKind() const;
 
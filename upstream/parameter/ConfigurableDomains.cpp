@@ -31,6 +31,10 @@
 #include "ConfigurableDomains.h"
 #include "ConfigurableDomain.h"
 #include "ConfigurableElement.h"
+#include "ImageFile.h"
+#include "XmlReaderDocSource.h"
+#include <map>
+#include <vector>
 
 #define base CElement
 
@@ -61,6 +65,57 @@ void CConfigurableDomains::validate(const CParameterBlackboard *pMainBlackboard)
     }
 }
 
+// Reloading
+void CConfigurableDomains::updateFrom(CConfigurableDomains &reloaded, core::Results &infos)
+{
+    // Take the domains out of both lists, then chain them back in the reloaded order
+    std::map<string, CConfigurableDomain *> domains;
+
+    while (getNbChildren() != 0) {
+
+        CConfigurableDomain *pDomain = static_cast<CConfigurableDomain *>(getChild(0));
+        removeChild(pDomain);
+        domains[pDomain->getName()] = pDomain;
+    }
+    std::vector<CConfigurableDomain *> reloadedDomains;
+
+    while (reloaded.getNbChildren() != 0) {
+
+        CConfigurableDomain *pDomain = static_cast<CConfigurableDomain *>(reloaded.getChild(0));
+        reloaded.removeChild(pDomain);
+        reloadedDomains.push_back(pDomain);
+    }
+    for (CConfigurableDomain *pReloadedDomain : reloadedDomains) {
+
+        auto it = domains.find(pReloadedDomain->getName());
+
+        if (it == domains.end()) {
+
+            infos.push_back("Added domain " + pReloadedDomain->getName());
+            addChild(pReloadedDomain);
+            continue;
+        }
+        CConfigurableDomain *pDomain = it->second;
+        domains.erase(it);
+
+        if (pDomain->updateFrom(*pReloadedDomain, infos)) {
+
+            addChild(pDomain);
+            delete pReloadedDomain;
+        } else {
+
+            infos.push_back("Replaced domain " + pDomain->getName());
+            addChild(pReloadedDomain);
+            delete pDomain;
+        }
+    }
+    for (const auto &domain : domains) {
+
+        infos.push_back("Deleted domain " + domain.first);
+        delete domain.second;
+    }
+}
+
 // Configuration application if required
 void CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet,
                                  bool bForce, core::Results &infos) const
@@ -470,6 +525,23 @@ bool CConfigurableDomains::getElementSequence(const string &strDomain,
     return pConfigurableDomain->getElementSequence(strConfiguration, strResult);
 }
 
+bool CConfigurableDomains::listDifferingParameters(const string &strDomain,
+                                                   const string &strConfiguration,
+                                                   const string &strOtherConfiguration,
+                                                   string &strResult) const
+{
+    // Find domain
+    const CConfigurableDomain *pConfigurableDomain = findConfigurableDomain(strDomain, strResult);
+
+    if (!pConfigurableDomain) {
+
+        return false;
+    }
+    // Delegate to domain
+    return pConfigurableDomain->listDifferingParameters(strConfiguration, strOtherConfiguration,
+                                                        strResult);
+}
+
 bool CConfigurableDomains::setApplicationRule(
     const string &strDomain, const string &strConfiguration, const string &strApplicationRule,
     const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition, string &strError)
@@ -532,6 +604,108 @@ void CConfigurableDomains::listLastAppliedConfigurations(string &strResult) cons
     }
 }
 
+void CConfigurableDomains::showSettingsMemory(string &strResult) const
+{
+    SSettingsMemoryUsage usage;
+
+    // Browse domains
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->accountSettingsMemory(usage);
+    }
+
+    size_t uncompressedSettingsSize = usage.settingsSize - usage.compressedSettingsSize;
+
+    strResult += "Area configurations: " + std::to_string(usage.areaCount) + "\n";
+    strResult += "Shared payloads: " + std::to_string(usage.sharedPayloads.size()) + "\n";
+    strResult += "Compressed configurations: " +
+                 std::to_string(usage.compressedConfigurationCount) + "\n";
+    strResult += "Configurations pending in settings image: " +
+                 std::to_string(usage.pendingConfigurationCount) + "\n";
+    strResult += "Settings size: " + std::to_string(usage.settingsSize) + " bytes\n";
+    strResult +=
+        "Stored size: " + std::to_string(usage.storedSize + usage.compressedSize) + " bytes\n";
+    strResult += "Saved by sharing: " +
+                 std::to_string(uncompressedSettingsSize - usage.storedSize) + " bytes\n";
+    strResult += "Saved by compression: " +
+                 std::to_string(usage.compressedSettingsSize - usage.compressedSize) + " bytes\n";
+    strResult += "Inflations: " + std::to_string(usage.inflationCount) + "\n";
+    strResult += "Inflation duration: " + std::to_string(usage.inflationDuration.count()) +
+                 " us (max " + std::to_string(usage.maxInflationDuration.count()) + " us)\n";
+}
+
+void CConfigurableDomains::compressIdleConfigurations(std::chrono::milliseconds idleDelay)
+{
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->compressIdleConfigurations(idleDelay);
+    }
+}
+
+// Settings image
+bool CConfigurableDomains::fromXmlReader(CXmlReaderDocSource &docSource,
+                                         CXmlSerializingContext &serializingContext)
+{
+    CXmlElement xmlElement;
+    docSource.getRootElement(xmlElement);
+
+    string strDescription;
+    xmlElement.getAttribute(gDescriptionPropertyName, strDescription);
+    setDescription(strDescription);
+
+    return docSource.processChildren(
+        [&](const CXmlElement &childElement) {
+            return childFromXml(childElement, serializingContext);
+        },
+        serializingContext);
+}
+
+void CConfigurableDomains::toImage(CImageWriter &writer) const
+{
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    writer.writeUInt32(static_cast<uint32_t>(uiNbConfigurableDomains));
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->toImage(writer);
+    }
+}
+
+bool CConfigurableDomains::fromImage(CImageReader &reader, CSystemClass &systemClass,
+                                     const CSelectionCriteriaDefinition *criteriaDefinition,
+                                     string &strError)
+{
+    size_t uiNbConfigurableDomains = reader.readUInt32();
+
+    for (size_t domain = 0; domain < uiNbConfigurableDomains && !reader.hasFailed(); domain++) {
+
+        CConfigurableDomain *pConfigurableDomain = new CConfigurableDomain;
+
+        // Hierarchy first, so that a partially read domain gets cleaned along with the others
+        addChild(pConfigurableDomain);
+
+        if (!pConfigurableDomain->fromImage(reader, systemClass, criteriaDefinition, strError)) {
+
+            return false;
+        }
+    }
+    return true;
+}
+
 // Configurable element - domain association
 bool CConfigurableDomains::addConfigurableElementToDomain(
     const string &domainName, CConfigurableElement *element,
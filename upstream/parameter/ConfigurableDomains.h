@@ -31,6 +31,7 @@
 
 #include "Element.h"
 #include "Results.h"
+#include <chrono>
 #include <set>
 #include <string>
 
@@ -39,6 +40,10 @@ class CConfigurableElement;
 class CSyncerSet;
 class CConfigurableDomain;
 class CSelectionCriteriaDefinition;
+class CSystemClass;
+class CImageWriter;
+class CImageReader;
+class CXmlReaderDocSource;
 
 class CConfigurableDomains : public CElement
 {
@@ -122,6 +127,10 @@ public:
                             std::string &strError);
     bool getElementSequence(const std::string &strDomain, const std::string &strConfiguration,
                             std::string &strResult) const;
+    bool listDifferingParameters(const std::string &strDomain,
+                                 const std::string &strConfiguration,
+                                 const std::string &strOtherConfiguration,
+                                 std::string &strResult) const;
     bool setApplicationRule(const std::string &strDomain, const std::string &strConfiguration,
                             const std::string &strApplicationRule,
                             const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
@@ -134,6 +143,19 @@ public:
     // Last applied configurations
     void listLastAppliedConfigurations(std::string &strResult) const;
 
+    /** Show the memory used by the configuration settings of all domains
+     *
+     * @param[out] strResult the human readable memory report
+     */
+    void showSettingsMemory(std::string &strResult) const;
+
+    /** Compress the settings of the configurations that have not been restored for a while
+     *
+     * @param[in] idleDelay the time after which settings that have not been restored are
+     *                      compressed
+     */
+    void compressIdleConfigurations(std::chrono::milliseconds idleDelay);
+
     /** Associate a configurable element to a domain
      *
      * @param[in] domainName the domain name
@@ -163,9 +185,47 @@ public:
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
+    /** Create the domains of a document read one domain at a time
+     *
+     * Each domain is built, with its settings, before the next one is read: the XML of a single
+     * domain is in memory at once.
+     *
+     * @param[in] docSource the populated document source
+     * @param[in] serializingContext the domain import context, used as error output
+     * @return true on success, false otherwise
+     */
+    bool fromXmlReader(CXmlReaderDocSource &docSource,
+                       CXmlSerializingContext &serializingContext);
+
+    // Settings image composing
+    void toImage(CImageWriter &writer) const;
+
+    /** Create the domains described in a settings image
+     *
+     * @param[in] reader the settings image payload
+     * @param[in] systemClass the structure the domains refer to
+     * @param[in] criteriaDefinition the criteria the configuration rules refer to
+     * @param[out] strError human readable error
+     * @return true on success, false otherwise
+     */
+    bool fromImage(CImageReader &reader, CSystemClass &systemClass,
+                   const CSelectionCriteriaDefinition *criteriaDefinition, std::string &strError);
+
     // Ensure validity on whole domains from main blackboard
     void validate(const CParameterBlackboard *pMainBlackboard);
 
+    /** Take the domains read again from the settings, keeping what did not change
+     *
+     * Domains are matched by name. A matching domain with the same elements and configurations
+     * is updated in place with the reloaded rules and settings, see
+     * CConfigurableDomain::updateFrom; it is replaced by the reloaded one otherwise. Domains
+     * that are not reloaded are deleted. The domains end up in the reloaded order.
+     *
+     * @param[in,out] reloaded the reloaded domains, emptied
+     * @param[out] infos what changed in the domains
+     */
+    void updateFrom(CConfigurableDomains &reloaded, core::Results &infos);
+
     /** Apply the configuration if required
      *
      * @param[in] pParameterBlackboard the blackboard to synchronize
@@ -495,16 +495,8 @@ bool CConfigurableElement::isRogue() const
         return false;
     }
 
-    // Get a list of elements (current + descendants) with no domains associated
-    std::list<const CConfigurableElement *> rogueElementList;
-
-    CConfigurableElementAggregator agregator(rogueElementList,
-                                             &CConfigurableElement::hasNoDomainAssociated);
-
-    agregator.aggegate(this);
-
-    // Check only one element found which ought to be current one
-    return (rogueElementList.size() == 1) && (rogueElementList.front() == this);
+    // Check neither current element nor its descendants are associated to a domain
+    return hasNoDomainAssociatedDescending();
 }
 
 // Footprint as string
@@ -520,6 +512,29 @@ bool CConfigurableElement::hasNoDomainAssociated() const
     return _configurableDomainList.empty();
 }
 
+// Recursive check for no domain association
+bool CConfigurableElement::hasNoDomainAssociatedDescending() const
+{
+    if (!hasNoDomainAssociated()) {
+
+        return false;
+    }
+
+    size_t uiNbChildren = getNbChildren();
+
+    for (size_t index = 0; index < uiNbChildren; index++) {
+
+        const CConfigurableElement *pChildConfigurableElement =
+            static_cast<const CConfigurableElement *>(getChild(index));
+
+        if (!pChildConfigurableElement->hasNoDomainAssociatedDescending()) {
+
+            return false;
+        }
+    }
+    return true;
+}
+
 // Matching check for no valid associated domains
 bool CConfigurableElement::hasNoValidDomainAssociated() const
 {
@@ -554,12 +569,16 @@ void CConfigurableElement::listAssociatedDomains(std::string &strResult, bool bV
 
 size_t CConfigurableElement::getBelongingDomainCount() const
 {
-    // Get belonging domain list
-    std::list<const CConfigurableDomain *> configurableDomainList;
+    // Count along the ascendents rather than listing the domains, access checks call this
+    size_t count = _configurableDomainList.size();
 
-    getBelongingDomains(configurableDomainList);
+    const CElement *pParent = getParent();
 
-    return configurableDomainList.size();
+    if (isOfConfigurableElementType(pParent)) {
+
+        count += static_cast<const CConfigurableElement *>(pParent)->getBelongingDomainCount();
+    }
+    return count;
 }
 
 void CConfigurableElement::listDomains(
@@ -220,6 +220,9 @@ private:
     // Belonging domain ascending search
     bool belongsToDomainAscending(const CConfigurableDomain *pConfigurableDomain) const;
 
+    // Domain association check of current element and its descendants
+    bool hasNoDomainAssociatedDescending() const;
+
     // Belonging domains
     void getBelongingDomains(std::list<const CConfigurableDomain *> &configurableDomainList) const;
     void listDomains(const std::list<const CConfigurableDomain *> &configurableDomainList,
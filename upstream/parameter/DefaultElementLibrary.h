@@ -71,6 +71,11 @@ public:
       */
     CElement *createElement(const CXmlElement &xmlElement) const;
 
+    /** Create an element without its XML description, falling back to the default builder as
+      * createElement does.
+      */
+    CElement *createNamedElement(const std::string &type, const std::string &name) const;
+
 private:
     std::unique_ptr<CDefaultElementBuilder> _defaultBuilder;
 };
@@ -94,3 +99,23 @@ CElement *CDefaultElementLibrary<CDefaultElementBuilder>::createElement(
     // Use the default builder
     return _defaultBuilder->createElement(xmlElement);
 }
+
+template <class CDefaultElementBuilder>
+CElement *CDefaultElementLibrary<CDefaultElementBuilder>::createNamedElement(
+    const std::string &type, const std::string &name) const
+{
+    CElement *builtElement = CElementLibrary::createNamedElement(type, name);
+
+    if (builtElement != NULL) {
+        // The element was created, return it
+        return builtElement;
+    }
+
+    if (_defaultBuilder == nullptr) {
+        // The default builder mechanism is not enabled
+        return NULL;
+    }
+
+    // Use the default builder
+    return _defaultBuilder->createNamedElement(name);
+}
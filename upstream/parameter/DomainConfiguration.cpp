@@ -31,11 +31,14 @@
 #include "ConfigurableElement.h"
 #include "CompoundRule.h"
 #include "Subsystem.h"
+#include "BlackboardComparator.h"
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainImportContext.h"
 #include "XmlDomainExportContext.h"
 #include "ConfigurationAccessContext.h"
 #include "AlwaysAssert.hpp"
+#include "Compression.h"
+#include "ImageFile.h"
 #include <assert.h>
 #include <cstdlib>
 #include <algorithm>
@@ -66,6 +69,8 @@ bool CDomainConfiguration::childrenAreDynamic() const
 bool CDomainConfiguration::parseSettings(CXmlElement &xmlConfigurationSettingsElement,
                                          CXmlDomainImportContext &context)
 {
+    inflate();
+
     // Parse configurable element's configuration settings
     CXmlElement::CChildIterator it(xmlConfigurationSettingsElement);
 
@@ -108,6 +113,8 @@ bool CDomainConfiguration::parseSettings(CXmlElement &xmlConfigurationSettingsEl
 void CDomainConfiguration::composeSettings(CXmlElement &xmlConfigurationSettingsElement,
                                            CXmlDomainExportContext &context) const
 {
+    inflate();
+
     // Go through all are configurations
     for (auto &areaConfiguration : mAreaConfigurationList) {
 
@@ -130,6 +137,103 @@ void CDomainConfiguration::composeSettings(CXmlElement &xmlConfigurationSettings
     }
 }
 
+// Settings image composing
+void CDomainConfiguration::toImage(CImageWriter &writer) const
+{
+    inflate();
+
+    // Application rule, empty if none
+    const CCompoundRule *pRule = getRule();
+    writer.writeString(pRule ? pRule->dump() : "");
+
+    // Area configurations, in sequence order
+    writer.writeUInt32(static_cast<uint32_t>(mAreaConfigurationList.size()));
+
+    for (auto &areaConfiguration : mAreaConfigurationList) {
+
+        const CParameterBlackboard &blackboard = areaConfiguration->getBlackboard();
+        std::vector<uint8_t> settings(blackboard.getSize());
+        blackboard.readBuffer(settings.data(), settings.size(), 0);
+
+        writer.writeString(areaConfiguration->getConfigurableElement()->getPath());
+        writer.writeUInt8(areaConfiguration->isValid());
+        writer.writeUInt32(static_cast<uint32_t>(settings.size()));
+        writer.writeBytes(settings.data(), settings.size());
+    }
+}
+
+// Settings image parsing
+bool CDomainConfiguration::fromImage(
+    CImageReader &reader, const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+    string &strError)
+{
+    inflate();
+
+    // Application rule
+    string strApplicationRule = reader.readString();
+
+    if (!strApplicationRule.empty() &&
+        !setApplicationRule(strApplicationRule, pSelectionCriteriaDefinition, strError)) {
+
+        strError = "Invalid application rule of configuration " + getPath() + ": " + strError;
+        return false;
+    }
+
+    // Area configurations, their settings being copied on first use if the image is kept
+    size_t nbAreaConfigurations = reader.readUInt32();
+    auto insertLocation = begin(mAreaConfigurationList);
+    std::unique_ptr<SPendingSettings> pendingSettings;
+
+    if (reader.getOwner() != nullptr) {
+
+        pendingSettings.reset(new SPendingSettings{reader.getOwner(), {}});
+    }
+
+    for (size_t area = 0; area < nbAreaConfigurations && !reader.hasFailed(); area++) {
+
+        string configurableElementPath = reader.readString();
+        bool bValid = reader.readUInt8() != 0;
+        size_t size = reader.readUInt32();
+        const uint8_t *settings = reader.readBytes(size);
+
+        auto areaConfiguration = findAreaConfigurationByPath(configurableElementPath);
+        if (areaConfiguration == end(mAreaConfigurationList)) {
+
+            strError = "Configurable Element " + configurableElementPath +
+                       " referred to by Configuration " + getPath() + " not associated to Domain";
+            return false;
+        }
+        if (settings == NULL) {
+
+            // Truncated image, reported by the caller
+            break;
+        }
+        if (pendingSettings) {
+
+            size_t areaSize = (*areaConfiguration)->getBlackboard().getSize();
+
+            if (!(*areaConfiguration)->deferRawSettings(size, bValid, strError)) {
+
+                return false;
+            }
+            pendingSettings->areas.push_back(
+                {areaConfiguration->get(), bValid ? settings : NULL, areaSize});
+
+        } else if (bValid && !(*areaConfiguration)->setRawSettings(settings, size, strError)) {
+
+            return false;
+        }
+        // Same ordering as when parsing XML settings
+        mAreaConfigurationList.splice(insertLocation, mAreaConfigurationList, areaConfiguration);
+        insertLocation = std::next(areaConfiguration);
+    }
+    if (pendingSettings && !pendingSettings->areas.empty()) {
+
+        mPendingSettings = std::move(pendingSettings);
+    }
+    return true;
+}
+
 // Serialize one configuration for one configurable element
 bool CDomainConfiguration::importOneConfigurableElementSettings(
     CAreaConfiguration *areaConfiguration, CXmlElement &xmlConfigurableElementSettingsElement,
@@ -214,12 +318,16 @@ bool CDomainConfiguration::exportOneConfigurableElementSettings(
 void CDomainConfiguration::addConfigurableElement(const CConfigurableElement *configurableElement,
                                                   const CSyncerSet *syncerSet)
 {
+    inflate();
+
     mAreaConfigurationList.emplace_back(configurableElement->createAreaConfiguration(syncerSet));
 }
 
 void CDomainConfiguration::removeConfigurableElement(
     const CConfigurableElement *pConfigurableElement)
 {
+    inflate();
+
     auto &areaConfigurationToRemove = getAreaConfiguration(pConfigurableElement);
 
     mAreaConfigurationList.remove(areaConfigurationToRemove);
@@ -228,6 +336,8 @@ void CDomainConfiguration::removeConfigurableElement(
 bool CDomainConfiguration::setElementSequence(const std::vector<string> &newElementSequence,
                                               string &error)
 {
+    inflate();
+
     std::vector<string> elementSequenceSet;
     auto insertLocation = begin(mAreaConfigurationList);
 
@@ -312,6 +422,8 @@ string CDomainConfiguration::getApplicationRule() const
 CParameterBlackboard *CDomainConfiguration::getBlackboard(
     const CConfigurableElement *pConfigurableElement) const
 {
+    inflate();
+
     const auto &it = find_if(begin(mAreaConfigurationList), end(mAreaConfigurationList),
                              [&](const AreaConfiguration &conf) {
                                  return conf != nullptr &&
@@ -326,6 +438,8 @@ CParameterBlackboard *CDomainConfiguration::getBlackboard(
 // Save data from current
 void CDomainConfiguration::save(const CParameterBlackboard *pMainBlackboard)
 {
+    inflate();
+
     // Just propagate to areas
     for (auto &areaConfiguration : mAreaConfigurationList) {
         areaConfiguration->save(pMainBlackboard);
@@ -336,6 +450,9 @@ void CDomainConfiguration::save(const CParameterBlackboard *pMainBlackboard)
 bool CDomainConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool bSync,
                                    core::Results *errors) const
 {
+    inflate();
+    mLastUse = std::chrono::steady_clock::now();
+
     return std::accumulate(begin(mAreaConfigurationList), end(mAreaConfigurationList), true,
                            [&](bool accumulator, const AreaConfiguration &conf) {
                                return conf->restore(pMainBlackboard, bSync, errors) && accumulator;
@@ -346,6 +463,8 @@ bool CDomainConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool b
 void CDomainConfiguration::validate(const CConfigurableElement *pConfigurableElement,
                                     const CParameterBlackboard *pMainBlackboard)
 {
+    inflate();
+
     auto &areaConfigurationToValidate = getAreaConfiguration(pConfigurableElement);
 
     // Delegate
@@ -355,11 +474,162 @@ void CDomainConfiguration::validate(const CConfigurableElement *pConfigurableEle
 // Ensure validity of all area configurations
 void CDomainConfiguration::validate(const CParameterBlackboard *pMainBlackboard)
 {
+    // Valid settings are left untouched, do not bring them back needlessly
+    if (std::all_of(begin(mAreaConfigurationList), end(mAreaConfigurationList),
+                    [](const AreaConfiguration &conf) { return conf->isValid(); })) {
+
+        return;
+    }
+    inflate();
+
     for (auto &areaConfiguration : mAreaConfigurationList) {
         areaConfiguration->validate(pMainBlackboard);
     }
 }
 
+// Settings memory accounting
+void CDomainConfiguration::accountSettingsMemory(SSettingsMemoryUsage &usage) const
+{
+    usage.inflationCount += mInflationCount;
+    usage.inflationDuration += mInflationDuration;
+    usage.maxInflationDuration = std::max(usage.maxInflationDuration, mMaxInflationDuration);
+
+    if (mPendingSettings) {
+
+        usage.pendingConfigurationCount++;
+    }
+    if (mCompressedSettings) {
+
+        usage.areaCount += mAreaConfigurationList.size();
+        usage.settingsSize += mCompressedSettings->size;
+        usage.compressedConfigurationCount++;
+        usage.compressedSettingsSize += mCompressedSettings->size;
+        usage.compressedSize += mCompressedSettings->data.size();
+        return;
+    }
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+        usage.account(areaConfiguration->getBlackboard());
+    }
+}
+
+// Settings comparison
+void CDomainConfiguration::listDifferingParameters(const CDomainConfiguration &other,
+                                                   string &strResult) const
+{
+    inflate();
+    other.inflate();
+
+    std::vector<string> paths;
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        const CConfigurableElement *element = areaConfiguration->getConfigurableElement();
+        CBlackboardComparator comparator(areaConfiguration->getBlackboard(),
+                                         *other.getBlackboard(element), element->getOffset());
+
+        comparator.listDifferingParameters(*element, paths);
+    }
+    for (const auto &path : paths) {
+
+        strResult += path + "\n";
+    }
+}
+
+// Settings compression
+void CDomainConfiguration::compressIfIdle(std::chrono::milliseconds idleDelay)
+{
+    if (mCompressedSettings || mPendingSettings ||
+        std::chrono::steady_clock::now() - mLastUse < idleDelay) {
+
+        return;
+    }
+    std::unique_ptr<SCompressedSettings> compressedSettings(new SCompressedSettings);
+    std::vector<uint8_t> settings;
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        const CParameterBlackboard &blackboard = areaConfiguration->getBlackboard();
+        std::vector<uint8_t> areaSettings(blackboard.getSize());
+
+        blackboard.readBytes(areaSettings, 0);
+        settings.insert(end(settings), begin(areaSettings), end(areaSettings));
+        compressedSettings->areaSizes.push_back(areaSettings.size());
+    }
+    compressedSettings->size = settings.size();
+    compressedSettings->data = utility::compression::compress(settings);
+
+    if (compressedSettings->data.size() >= settings.size()) {
+
+        // Not worth it, try again after another idle delay
+        mLastUse = std::chrono::steady_clock::now();
+        return;
+    }
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+        areaConfiguration->getBlackboard().setSize(0);
+    }
+    mCompressedSettings = std::move(compressedSettings);
+}
+
+// Lazy settings loading
+void CDomainConfiguration::materialize() const
+{
+    if (!mPendingSettings) {
+
+        return;
+    }
+    for (const auto &area : mPendingSettings->areas) {
+
+        CParameterBlackboard &blackboard = area.areaConfiguration->getBlackboard();
+        blackboard.setSize(area.size);
+
+        if (area.settings != NULL) {
+
+            string strError;
+            bool success =
+                area.areaConfiguration->setRawSettings(area.settings, area.size, strError);
+            ALWAYS_ASSERT(success, strError);
+        }
+    }
+    mPendingSettings.reset();
+}
+
+void CDomainConfiguration::inflate() const
+{
+    materialize();
+
+    if (!mCompressedSettings) {
+
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<uint8_t> settings;
+    bool success = utility::compression::decompress(mCompressedSettings->data,
+                                                    mCompressedSettings->size, settings);
+    ALWAYS_ASSERT(success, "Corrupted compressed settings in configuration " << getPath());
+
+    size_t offset = 0;
+    auto areaSize = begin(mCompressedSettings->areaSizes);
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        CParameterBlackboard &blackboard = areaConfiguration->getBlackboard();
+
+        blackboard.setSize(*areaSize);
+        blackboard.writeBuffer(settings.data() + offset, *areaSize, 0);
+        blackboard.share();
+
+        offset += *areaSize++;
+    }
+    mCompressedSettings.reset();
+
+    mLastUse = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(mLastUse - start);
+    mInflationCount++;
+    mInflationDuration += duration;
+    mMaxInflationDuration = std::max(mMaxInflationDuration, duration);
+}
+
 // Return configuration validity for given configurable element
 bool CDomainConfiguration::isValid(const CConfigurableElement *pConfigurableElement) const
 {
@@ -377,6 +647,9 @@ bool CDomainConfiguration::isValid(const CConfigurableElement *pConfigurableElem
 void CDomainConfiguration::validateAgainst(const CDomainConfiguration *pValidDomainConfiguration,
                                            const CConfigurableElement *pConfigurableElement)
 {
+    inflate();
+    pValidDomainConfiguration->inflate();
+
     // Retrieve related area configurations
     auto &areaConfigurationToValidate = getAreaConfiguration(pConfigurableElement);
     const auto &areaConfigurationToValidateAgainst =
@@ -388,6 +661,9 @@ void CDomainConfiguration::validateAgainst(const CDomainConfiguration *pValidDom
 
 void CDomainConfiguration::validateAgainst(const CDomainConfiguration *validDomainConfiguration)
 {
+    inflate();
+    validDomainConfiguration->inflate();
+
     ALWAYS_ASSERT(mAreaConfigurationList.size() ==
                       validDomainConfiguration->mAreaConfigurationList.size(),
                   "Cannot validate domain configuration "
@@ -404,6 +680,42 @@ void CDomainConfiguration::validateAgainst(const CDomainConfiguration *validDoma
     }
 }
 
+// Reloading
+bool CDomainConfiguration::updateFrom(CDomainConfiguration &reloaded, bool &bRuleChanged)
+{
+    bRuleChanged = getApplicationRule() != reloaded.getApplicationRule();
+
+    if (bRuleChanged) {
+
+        CCompoundRule *pRule = reloaded.getRule();
+
+        if (pRule) {
+
+            reloaded.removeChild(pRule);
+        }
+        setRule(pRule);
+    }
+
+    inflate();
+    reloaded.inflate();
+
+    bool bSettingsChanged = false;
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        const auto &reloadedAreaConfiguration =
+            reloaded.getAreaConfiguration(areaConfiguration->getConfigurableElement());
+
+        // Settings missing from the reloaded configuration are kept
+        if (reloadedAreaConfiguration->isValid() &&
+            areaConfiguration->updateFrom(*reloadedAreaConfiguration)) {
+
+            bSettingsChanged = true;
+        }
+    }
+    return bSettingsChanged;
+}
+
 // Dynamic data application
 bool CDomainConfiguration::isApplicable() const
 {
@@ -416,6 +728,8 @@ bool CDomainConfiguration::isApplicable() const
 void CDomainConfiguration::merge(CConfigurableElement *pToConfigurableElement,
                                  CConfigurableElement *pFromConfigurableElement)
 {
+    inflate();
+
     // Retrieve related area configurations
     auto &areaConfigurationToMergeTo = getAreaConfiguration(pToConfigurableElement);
     const auto &areaConfigurationToMergeFrom = getAreaConfiguration(pFromConfigurableElement);
@@ -427,6 +741,8 @@ void CDomainConfiguration::merge(CConfigurableElement *pToConfigurableElement,
 // Domain splitting
 void CDomainConfiguration::split(CConfigurableElement *pFromConfigurableElement)
 {
+    inflate();
+
     // Retrieve related area configuration
     const auto &areaConfigurationToSplitFrom = getAreaConfiguration(pFromConfigurableElement);
 
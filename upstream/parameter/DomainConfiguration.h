@@ -34,6 +34,8 @@
 #include "XmlDomainExportContext.h"
 #include "Element.h"
 #include "Results.h"
+#include "SettingsMemoryUsage.h"
+#include <chrono>
 #include <list>
 #include <string>
 #include <memory>
@@ -44,6 +46,8 @@ class CConfigurationAccessContext;
 class CCompoundRule;
 class CSyncerSet;
 class CSelectionCriteriaDefinition;
+class CImageWriter;
+class CImageReader;
 
 class CDomainConfiguration : public CElement
 {
@@ -107,6 +111,14 @@ public:
     // Ensure validity of all configurable element's area configuration by copying in from a valid
     // ones
     void validateAgainst(const CDomainConfiguration *validDomainConfiguration);
+    /** Take the application rule and the valid settings of a reloaded configuration
+     *
+     * @param[in,out] reloaded the configuration of the same name in the reloaded domain, with
+     *                         the same elements and element sequence; its rule is taken
+     * @param[out] bRuleChanged true if the application rule changed
+     * @return true if the settings changed
+     */
+    bool updateFrom(CDomainConfiguration &reloaded, bool &bRuleChanged);
     // Applicability checking
     bool isApplicable() const;
     // Merge existing configurations to given configurable element ones
@@ -121,6 +133,52 @@ public:
     void composeSettings(CXmlElement &xmlConfigurationSettingsElement,
                          CXmlDomainExportContext &context) const;
 
+    // Settings image composing
+    void toImage(CImageWriter &writer) const;
+
+    /** Read the application rule and the settings from a settings image
+     *
+     * If the reader shares the ownership of the image, the settings are only copied out of it
+     * on their first use.
+     *
+     * @param[in] reader the settings image payload
+     * @param[in] pSelectionCriteriaDefinition the criteria the application rule refers to
+     * @param[out] strError human readable error
+     * @return true on success, false otherwise
+     */
+    bool fromImage(CImageReader &reader,
+                   const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+                   std::string &strError);
+
+    // Settings memory accounting
+    void accountSettingsMemory(SSettingsMemoryUsage &usage) const;
+
+    /** List the parameters whose settings differ from another configuration of the domain
+     *
+     * @param[in] other the configuration to compare with
+     * @param[out] strResult the differing parameter paths, one per line
+     */
+    void listDifferingParameters(const CDomainConfiguration &other, std::string &strResult) const;
+
+    /** Compress the settings if they have not been restored for a while
+     *
+     * Compressed settings are transparently inflated back on their next use.
+     * The area configuration blackboards are freed: the caller and all the readers of the
+     * settings must hold the parameter manager blackboard mutex.
+     *
+     * @param[in] idleDelay the time after which settings that have not been restored are
+     *                      compressed
+     */
+    void compressIfIdle(std::chrono::milliseconds idleDelay);
+
+    /** Copy the settings still in the settings image to the area configurations, if any
+     *
+     * Happens transparently on the first use of the settings, may be called to anticipate it.
+     * As any use of the settings, must be called with the parameter manager blackboard mutex
+     * locked, or in tuning mode once the settings warm-up is stopped.
+     */
+    void materialize() const;
+
     // Class kind
     virtual std::string getKind() const;
 
@@ -156,5 +214,48 @@ private:
     CCompoundRule *getRule();
     void setRule(CCompoundRule *pRule);
 
+    /** Bring pending or compressed settings back to the area configurations, if needed
+     *
+     * Must be called before any access to the area configuration settings.
+     */
+    void inflate() const;
+
     AreaConfigurations mAreaConfigurationList;
+
+    /** Settings of all area configurations, while compressed */
+    struct SCompressedSettings
+    {
+        /** Concatenation of the area configuration settings, compressed */
+        std::vector<uint8_t> data;
+        /** Size of each area configuration settings, in area configuration list order */
+        std::vector<size_t> areaSizes;
+        /** Size of the settings once inflated */
+        size_t size;
+    };
+    mutable std::unique_ptr<SCompressedSettings> mCompressedSettings;
+
+    /** Settings of the area configurations, while still in the settings image */
+    struct SPendingSettings
+    {
+        /** Keeps the settings image alive */
+        std::shared_ptr<const void> image;
+
+        struct SArea
+        {
+            CAreaConfiguration *areaConfiguration;
+            /** Settings in the image, NULL if the area configuration is not valid */
+            const uint8_t *settings;
+            size_t size;
+        };
+        std::vector<SArea> areas;
+    };
+    mutable std::unique_ptr<SPendingSettings> mPendingSettings;
+
+    // Last time the settings were restored or inflated
+    mutable std::chrono::steady_clock::time_point mLastUse{std::chrono::steady_clock::now()};
+
+    // Inflation statistics
+    mutable size_t mInflationCount{0};
+    mutable std::chrono::microseconds mInflationDuration{0};
+    mutable std::chrono::microseconds mMaxInflationDuration{0};
 };
@@ -41,7 +41,7 @@ using std::string;
 
 const std::string CElement::gDescriptionPropertyName = "Description";
 
-CElement::CElement(const string &strName) : _strName(strName)
+CElement::CElement(const string &strName) : _name(strName)
 {
 }
 
@@ -96,7 +96,7 @@ string CElement::dumpContent(utility::ErrorContext &errorContext, const size_t d
     output += strIndent + "- " + getKind();
 
     // Name
-    if (!_strName.empty()) {
+    if (!_name.empty()) {
 
         output += ": " + getName();
     }
@@ -151,38 +151,44 @@ bool CElement::fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &se
 
     while (childIterator.next(childElement)) {
 
-        CElement *pChild;
+        if (!childFromXml(childElement, serializingContext)) {
 
-        if (!childrenAreDynamic()) {
+            return false;
+        }
+    }
 
-            pChild = findChildOfKind(childElement.getType());
+    return true;
+}
 
-            if (!pChild) {
+bool CElement::childFromXml(const CXmlElement &childElement,
+                            CXmlSerializingContext &serializingContext)
+{
+    CElement *pChild;
 
-                serializingContext.setError("Unable to handle XML element: " +
-                                            childElement.getPath());
+    if (!childrenAreDynamic()) {
 
-                return false;
-            }
+        pChild = findChildOfKind(childElement.getType());
 
-        } else {
-            // Child needs creation
-            pChild = createChild(childElement, serializingContext);
+        if (!pChild) {
 
-            if (!pChild) {
+            serializingContext.setError("Unable to handle XML element: " +
+                                        childElement.getPath());
 
-                return false;
-            }
+            return false;
         }
 
-        // Dig
-        if (!pChild->fromXml(childElement, serializingContext)) {
+    } else {
+        // Child needs creation
+        pChild = createChild(childElement, serializingContext);
+
+        if (!pChild) {
 
             return false;
         }
     }
 
-    return true;
+    // Dig
+    return pChild->fromXml(childElement, serializingContext);
 }
 
 void CElement::childrenToXml(CXmlElement &xmlElement,
@@ -208,6 +214,17 @@ void CElement::toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializin
     childrenToXml(xmlElement, serializingContext);
 }
 
+void CElement::propertiesToImage(CImageWriter & /*writer*/) const
+{
+}
+
+bool CElement::propertiesFromImage(CImageReader & /*reader*/,
+                                   const CComponentLibrary & /*componentLibrary*/,
+                                   std::string & /*error*/)
+{
+    return true;
+}
+
 void CElement::setXmlDescriptionAttribute(CXmlElement &xmlElement) const
 {
     const string &description = getDescription();
@@ -230,12 +247,12 @@ void CElement::setXmlNameAttribute(CXmlElement &xmlElement) const
 // Name
 void CElement::setName(const string &strName)
 {
-    _strName = strName;
+    _name = utility::InternedString(strName);
 }
 
 const string &CElement::getName() const
 {
-    return _strName;
+    return _name.str();
 }
 
 bool CElement::rename(const string &strName, string &strError)
@@ -262,9 +279,9 @@ bool CElement::rename(const string &strName, string &strError)
 
 string CElement::getPathName() const
 {
-    if (!_strName.empty()) {
+    if (!_name.empty()) {
 
-        return _strName;
+        return _name.str();
     } else {
 
         return getKind();
@@ -459,9 +476,31 @@ bool CElement::isDescendantOf(const CElement *pCandidateAscendant) const
 
 CElement *CElement::findChild(const string &strName)
 {
+    return const_cast<CElement *>(static_cast<const CElement *>(this)->findChild(strName));
+}
+
+const CElement *CElement::findChild(const string &strName) const
+{
+    // A name that was never interned is not the name of any element
+    utility::InternedString name;
+    bool bInterned = utility::InternedString::find(strName, name);
+
+    // Array items are named after their index
+    if (bInterned) {
+
+        const CElement *pItem = findChildAtIndexName(strName);
+
+        if (pItem != NULL && pItem->_name == name) {
+
+            return pItem;
+        }
+    }
+
     for (CElement *pChild : _childArray) {
 
-        if (pChild->getPathName() == strName) {
+        // Compare handles, unnamed children are found by kind
+        if (pChild->_name.empty() ? pChild->getKind() == strName
+                                  : bInterned && pChild->_name == name) {
 
             return pChild;
         }
@@ -470,17 +509,28 @@ CElement *CElement::findChild(const string &strName)
     return NULL;
 }
 
-const CElement *CElement::findChild(const string &strName) const
+const CElement *CElement::findChildAtIndexName(const string &strName) const
 {
-    for (CElement *pChild : _childArray) {
+    if (strName.empty()) {
 
-        if (pChild->getPathName() == strName) {
+        return NULL;
+    }
+    size_t index = 0;
 
-            return pChild;
+    for (char digit : strName) {
+
+        if (digit < '0' || digit > '9') {
+
+            return NULL;
         }
-    }
+        index = index * 10 + (digit - '0');
 
-    return NULL;
+        if (index >= _childArray.size()) {
+
+            return NULL;
+        }
+    }
+    return _childArray[index];
 }
 
 CElement *CElement::findChildOfKind(const string &strKind)
@@ -38,8 +38,12 @@
 #include "XmlSource.h"
 
 #include "PathNavigator.h"
+#include "InternedString.h"
 
 class CXmlElementSerializingContext;
+class CImageWriter;
+class CImageReader;
+class CComponentLibrary;
 namespace utility
 {
 class ErrorContext;
@@ -125,6 +129,28 @@ public:
     virtual void childrenToXml(CXmlElement &xmlElement,
                                CXmlSerializingContext &serializingContext) const;
 
+    /**
+     * Serialize the properties read from the structure XML to a structure image
+     *
+     * Name, description and children are serialized by the structure image
+     * itself; derived classes only write what their fromXml() reads.
+     *
+     * @param[in,out] writer the structure image writer
+     */
+    virtual void propertiesToImage(CImageWriter &writer) const;
+
+    /**
+     * Restore the properties written by propertiesToImage()
+     *
+     * @param[in,out] reader the structure image reader
+     * @param[in] componentLibrary the component types referred to by name
+     * @param[out] error the reason of the failure
+     * @return true on success, false otherwise
+     */
+    virtual bool propertiesFromImage(CImageReader &reader,
+                                     const CComponentLibrary &componentLibrary,
+                                     std::string &error);
+
     // Content structure dump
     std::string dumpContent(utility::ErrorContext &errorContext, const size_t depth = 0) const;
 
@@ -171,6 +197,17 @@ protected:
     CElement *createChild(const CXmlElement &childElement,
                           CXmlSerializingContext &elementSerializingContext);
 
+    /**
+     * Find or create the child of an XML child element and populate it
+     *
+     * @param[in] childElement the XML child element
+     * @param[in] serializingContext the serializing context
+     *
+     * @return true on success, false otherwise
+     */
+    bool childFromXml(const CXmlElement &childElement,
+                      CXmlSerializingContext &serializingContext);
+
     static const std::string gDescriptionPropertyName;
 
 private:
@@ -180,11 +217,13 @@ private:
     virtual bool childrenAreDynamic() const;
     // House keeping
     void removeChildren();
+    // Child whose index is the given decimal name, as array items, NULL if none
+    const CElement *findChildAtIndexName(const std::string &strName) const;
     // Fill XmlElement during XML composing
     void setXmlNameAttribute(CXmlElement &xmlElement) const;
 
-    // Name
-    std::string _strName;
+    // Name, interned as siblings of different parents often share their name
+    utility::InternedString _name;
 
     // Description
     std::string _strDescription;
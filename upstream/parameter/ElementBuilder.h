@@ -38,4 +38,11 @@ public:
     virtual ~CElementBuilder() = default;
 
     virtual CElement *createElement(const CXmlElement &xmlElement) const = 0;
+
+    /** Create an element from its name only, as when restoring a structure image
+     *
+     * @param[in] name the name of the element
+     * @return the element, NULL if it can only be created from its XML description
+     */
+    virtual CElement *createNamedElement(const std::string & /*name*/) const { return NULL; }
 };
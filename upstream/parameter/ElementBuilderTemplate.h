@@ -36,4 +36,9 @@ class TElementBuilderTemplate : public CElementBuilder
 {
 public:
     virtual CElement *createElement(const CXmlElement & /*elem*/) const { return new ElementType; }
+
+    CElement *createNamedElement(const std::string & /*name*/) const override
+    {
+        return new ElementType;
+    }
 };
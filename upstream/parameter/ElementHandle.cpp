@@ -142,6 +142,16 @@ bool ElementHandle::getMappingData(const string &strKey, string &strValue) const
     return false;
 }
 
+ElementHandle::SubscriptionId ElementHandle::subscribeToChanges(ChangeCallback callback)
+{
+    return mParameterMgr.subscribeToChanges(mElement, std::move(callback));
+}
+
+void ElementHandle::unsubscribeFromChanges(SubscriptionId subscriptionId)
+{
+    mParameterMgr.unsubscribeFromChanges(subscriptionId);
+}
+
 bool ElementHandle::getStructureAsXML(std::string &xmlSettings, std::string &error) const
 {
     // Use default access context for structure export
@@ -54,6 +54,26 @@ CElement *CElementLibrary::createElement(const CXmlElement &xmlElement) const
 
         return it->second->createElement(xmlElement);
     }
+    if (_fallback != nullptr) {
+
+        return _fallback->createElement(xmlElement);
+    }
+    return NULL;
+}
+
+CElement *CElementLibrary::createNamedElement(const std::string &type,
+                                             const std::string &name) const
+{
+    ElementBuilderMapConstIterator it = _elementBuilderMap.find(type);
+
+    if (it != _elementBuilderMap.end()) {
+
+        return it->second->createNamedElement(name);
+    }
+    if (_fallback != nullptr) {
+
+        return _fallback->createNamedElement(type, name);
+    }
     return NULL;
 }
 
@@ -63,6 +83,11 @@ void CElementLibrary::addElementBuilder(const std::string &type,
     _elementBuilderMap[type] = pElementBuilder;
 }
 
+void CElementLibrary::setFallback(std::shared_ptr<const CElementLibrary> fallback)
+{
+    _fallback = fallback;
+}
+
 std::string CElementLibrary::getBuilderType(const CXmlElement &xmlElement) const
 {
     // Defaulting to xml element name
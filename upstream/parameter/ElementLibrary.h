@@ -32,6 +32,7 @@
 #include "parameter_export.h"
 
 #include <map>
+#include <memory>
 #include <string>
 
 #include "Element.h"
@@ -56,13 +57,30 @@ public:
     void addElementBuilder(const std::string &type, const CElementBuilder *pElementBuilder);
     void clean();
 
+    /** Look the tags this library has no builder of up in another library
+     *
+     * @param[in] fallback the library to look the tags up in
+     */
+    void setFallback(std::shared_ptr<const CElementLibrary> fallback);
+
     // Instantiation
     CElement *createElement(const CXmlElement &xmlElement) const;
 
+    /** Create an element without its XML description, see CElementBuilder::createNamedElement
+     *
+     * @param[in] type the tag of the XML element describing the element
+     * @param[in] name the name of the element
+     * @return the element, NULL if there is no builder of that tag able to create it
+     */
+    CElement *createNamedElement(const std::string &type, const std::string &name) const;
+
 private:
     // Builder type
     virtual std::string getBuilderType(const CXmlElement &xmlElement) const;
 
     // Builders
     ElementBuilderMap _elementBuilderMap;
+
+    // Library of the tags without builder, if any
+    std::shared_ptr<const CElementLibrary> _fallback;
 };
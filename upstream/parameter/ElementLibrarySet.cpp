@@ -30,23 +30,14 @@
 #include "ElementLibrarySet.h"
 #include <assert.h>
 
-CElementLibrarySet::~CElementLibrarySet()
+void CElementLibrarySet::addElementLibrary(std::shared_ptr<const CElementLibrary> elementLibrary)
 {
-    // FIXME: use an array of unique_ptr
-    for (auto *elementLibrary : _elementLibraryArray) {
-
-        delete elementLibrary;
-    }
-}
-
-void CElementLibrarySet::addElementLibrary(CElementLibrary *pElementLibrary)
-{
-    _elementLibraryArray.push_back(pElementLibrary);
+    _elementLibraryArray.push_back(elementLibrary);
 }
 
-CElementLibrary *CElementLibrarySet::getElementLibrary(size_t index) const
+const CElementLibrary *CElementLibrarySet::getElementLibrary(size_t index) const
 {
-    assert(index <= _elementLibraryArray.size());
+    assert(index < _elementLibraryArray.size());
 
-    return _elementLibraryArray[index];
+    return _elementLibraryArray[index].get();
 }
@@ -29,16 +29,16 @@
  */
 #include "ElementLibrary.h"
 
+#include <memory>
 #include <vector>
 
 class CElementLibrarySet
 {
 public:
-    ~CElementLibrarySet();
-
-    void addElementLibrary(CElementLibrary *pElementLibrary);
-    CElementLibrary *getElementLibrary(size_t index) const;
+    /** Add a library, possibly shared with other sets */
+    void addElementLibrary(std::shared_ptr<const CElementLibrary> elementLibrary);
+    const CElementLibrary *getElementLibrary(size_t index) const;
 
 private:
-    std::vector<CElementLibrary *> _elementLibraryArray;
+    std::vector<std::shared_ptr<const CElementLibrary>> _elementLibraryArray;
 };
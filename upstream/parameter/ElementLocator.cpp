@@ -29,17 +29,28 @@
  */
 #include "ElementLocator.h"
 #include "PathNavigator.h"
+#include "SystemClass.h"
 
 using std::string;
 
-CElementLocator::CElementLocator(CElement *pSubRootElement, bool bStrict)
-    : _pSubRootElement(pSubRootElement), _bStrict(bStrict)
+CElementLocator::CElementLocator(CSystemClass *pSystemClass, bool bStrict)
+    : _pSystemClass(pSystemClass), _bStrict(bStrict)
 {
 }
 
 // Locate element
 bool CElementLocator::locate(const string &strPath, CElement **ppElement, string &strError)
 {
+    // Elements are indexed by path
+    CElement *pIndexedElement = _pSystemClass->findElement(strPath);
+
+    if (pIndexedElement) {
+
+        *ppElement = pIndexedElement;
+        return true;
+    }
+
+    // Not found, navigate to report why or to accept an empty path
     CPathNavigator pathNavigator(strPath);
 
     if (!pathNavigator.isPathValid()) {
@@ -64,7 +75,7 @@ bool CElementLocator::locate(const string &strPath, CElement **ppElement, string
         return true;
     }
 
-    if (*pStrChildName != _pSubRootElement->getName()) {
+    if (*pStrChildName != _pSystemClass->getName()) {
 
         strError = "Path not found: " + strPath;
 
@@ -72,7 +83,7 @@ bool CElementLocator::locate(const string &strPath, CElement **ppElement, string
     }
 
     // Find in tree
-    *ppElement = _pSubRootElement->findDescendant(pathNavigator);
+    *ppElement = _pSystemClass->findDescendant(pathNavigator);
 
     if (!*ppElement) {
 
@@ -33,17 +33,19 @@
 
 #include <string>
 
+class CSystemClass;
+
 class CElementLocator
 {
 public:
-    CElementLocator(CElement *pSubRootElement, bool bStrict = true);
+    CElementLocator(CSystemClass *pSystemClass, bool bStrict = true);
 
     // Locate element
     bool locate(const std::string &strPath, CElement **ppElement, std::string &strError);
 
 private:
     // Subroot element
-    CElement *_pSubRootElement;
+    CSystemClass *_pSystemClass;
 
     // Strict means empty path will cause path not found error to be returned
     bool _bStrict;
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "EnumValuePair.h"
+#include "ImageFile.h"
 
 #define base CElement
 
@@ -66,6 +67,25 @@ bool CEnumValuePair::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CEnumValuePair::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt32(static_cast<uint32_t>(_iNumerical));
+}
+
+bool CEnumValuePair::propertiesFromImage(CImageReader &reader,
+                                         const CComponentLibrary &componentLibrary,
+                                         std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _iNumerical = static_cast<int32_t>(reader.readUInt32());
+    return true;
+}
+
 // Content dumping
 string CEnumValuePair::logValue(utility::ErrorContext & /*ctx*/) const
 {
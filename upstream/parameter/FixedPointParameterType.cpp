@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "FixedPointParameterType.h"
+#include "ImageFile.h"
 #include <stdlib.h>
 #include <sstream>
 #include <iomanip>
@@ -116,6 +117,27 @@ bool CFixedPointParameterType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CFixedPointParameterType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt32(_uiIntegral);
+    writer.writeUInt32(_uiFractional);
+}
+
+bool CFixedPointParameterType::propertiesFromImage(CImageReader &reader,
+                                                   const CComponentLibrary &componentLibrary,
+                                                   std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _uiIntegral = reader.readUInt32();
+    _uiFractional = reader.readUInt32();
+    return true;
+}
+
 bool CFixedPointParameterType::toBlackboard(const string &strValue, uint32_t &uiValue,
                                             CParameterAccessContext &parameterAccessContext) const
 {
@@ -193,24 +215,20 @@ bool CFixedPointParameterType::fromBlackboard(string &strValue, const uint32_t &
     // Check encodability
     assert(isEncodable(value, false));
 
-    // Format
-    std::ostringstream stream;
-
     // Raw formatting?
     if (parameterAccessContext.valueSpaceIsRaw()) {
         // Hexa formatting?
         if (parameterAccessContext.outputRawFormatIsHex()) {
             uint32_t data = static_cast<uint32_t>(value);
 
-            stream << "0x" << std::hex << std::uppercase
-                   << std::setw(static_cast<int>(getSize() * 2)) << std::setfill('0') << data;
+            strValue = toHexString(data, getSize() * 2);
         } else {
             int32_t data = value;
 
             // Sign extend
             signExtend(data);
 
-            stream << data;
+            strValue = std::to_string(data);
         }
     } else {
         int32_t data = value;
@@ -219,11 +237,9 @@ bool CFixedPointParameterType::fromBlackboard(string &strValue, const uint32_t &
         signExtend(data);
 
         // Conversion
-        stream << std::fixed << std::setprecision(_uiFractional) << binaryQnmToDouble(data);
+        strValue = toFixedString(binaryQnmToDouble(data), static_cast<int>(_uiFractional));
     }
 
-    strValue = stream.str();
-
     return true;
 }
 
@@ -41,6 +41,11 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
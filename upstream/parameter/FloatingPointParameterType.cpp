@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "FloatingPointParameterType.h"
+#include "ImageFile.h"
 #include <sstream>
 #include <iomanip>
 #include "ParameterAccessContext.h"
@@ -113,6 +114,27 @@ bool CFloatingPointParameterType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CFloatingPointParameterType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeDouble(_fMin);
+    writer.writeDouble(_fMax);
+}
+
+bool CFloatingPointParameterType::propertiesFromImage(CImageReader &reader,
+                                                      const CComponentLibrary &componentLibrary,
+                                                      std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _fMin = static_cast<float>(reader.readDouble());
+    _fMax = static_cast<float>(reader.readDouble());
+    return true;
+}
+
 bool CFloatingPointParameterType::toBlackboard(
     const string &strValue, uint32_t &uiValue,
     CParameterAccessContext &parameterAccessContext) const
@@ -206,27 +228,29 @@ bool CFloatingPointParameterType::fromBlackboard(
     string &strValue, const uint32_t &uiValue,
     CParameterAccessContext &parameterAccessContext) const
 {
-    std::ostringstream ostrStream;
-
     if (parameterAccessContext.valueSpaceIsRaw()) {
 
         if (parameterAccessContext.outputRawFormatIsHex()) {
 
+            // Padding is placed before the base, keep the stream formatting
+            std::ostringstream ostrStream;
+
             ostrStream << std::showbase << std::hex << std::setw(static_cast<int>(getSize() * 2))
-                       << std::setfill('0');
-        }
+                       << std::setfill('0') << uiValue;
 
-        ostrStream << uiValue;
+            strValue = ostrStream.str();
+        } else {
+
+            strValue = std::to_string(uiValue);
+        }
     } else {
 
         // Move from "raw memory" value space to real space
         auto fValue = utility::binaryCopy<float>(uiValue);
 
-        ostrStream << fValue;
+        strValue = toGeneralString(fValue);
     }
 
-    strValue = ostrStream.str();
-
     return true;
 }
 
@@ -38,6 +38,11 @@ public:
     CFloatingPointParameterType(const std::string &strName);
 
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
+
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
     virtual void handleValueSpaceAttribute(
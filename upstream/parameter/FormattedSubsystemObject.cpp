@@ -46,7 +46,7 @@ CFormattedSubsystemObject::CFormattedSubsystemObject(
 CFormattedSubsystemObject::CFormattedSubsystemObject(
     CInstanceConfigurableElement *pInstanceConfigurableElement, core::log::Logger &logger,
     const string &strMappingValue)
-    : base(pInstanceConfigurableElement, logger), _strFormattedMappingValue(strMappingValue)
+    : base(pInstanceConfigurableElement, logger), _formattedMappingValue(strMappingValue)
 {
 }
 
@@ -54,20 +54,22 @@ CFormattedSubsystemObject::CFormattedSubsystemObject(
     CInstanceConfigurableElement *pInstanceConfigurableElement, core::log::Logger &logger,
     const string &strMappingValue, size_t firstAmendKey, size_t nbAmendKeys,
     const CMappingContext &context)
-    : base(pInstanceConfigurableElement, logger), _strFormattedMappingValue(strMappingValue)
+    : base(pInstanceConfigurableElement, logger)
 {
+    string strFormattedMappingValue = strMappingValue;
+
     // Cope with quotes in the name
     if (strMappingValue[0] == '\'' && strMappingValue.length() >= 2) {
 
-        _strFormattedMappingValue = strMappingValue.substr(1, strMappingValue.length() - 2);
+        strFormattedMappingValue = strMappingValue.substr(1, strMappingValue.length() - 2);
     }
-    _strFormattedMappingValue =
-        formatMappingValue(_strFormattedMappingValue, firstAmendKey, nbAmendKeys, context);
+    _formattedMappingValue = utility::InternedString(
+        formatMappingValue(strFormattedMappingValue, firstAmendKey, nbAmendKeys, context));
 }
 
 string CFormattedSubsystemObject::getFormattedMappingValue() const
 {
-    return _strFormattedMappingValue;
+    return _formattedMappingValue.str();
 }
 
 bool CFormattedSubsystemObject::isAmendKeyValid(size_t uiAmendKey)
@@ -32,6 +32,7 @@
 #include "parameter_export.h"
 
 #include "SubsystemObject.h"
+#include "InternedString.h"
 
 class PARAMETER_EXPORT CFormattedSubsystemObject : public CSubsystemObject
 {
@@ -109,7 +110,7 @@ private:
                                           size_t nbAmendKeys, const CMappingContext &context);
 
     /**
-     * std::string containing the formatted mapping value
+     * Formatted mapping value, interned as array elements often share it
      */
-    std::string _strFormattedMappingValue;
+    utility::InternedString _formattedMappingValue;
 };
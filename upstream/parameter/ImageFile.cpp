@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ImageFile.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+using std::string;
+
+// Writer
+void CImageWriter::writeUInt8(uint8_t value)
+{
+    mData.push_back(value);
+}
+
+void CImageWriter::writeUInt32(uint32_t value)
+{
+    writeInteger(value, sizeof(value));
+}
+
+void CImageWriter::writeUInt64(uint64_t value)
+{
+    writeInteger(value, sizeof(value));
+}
+
+void CImageWriter::writeDouble(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    writeUInt64(bits);
+}
+
+void CImageWriter::writeString(const string &value)
+{
+    writeUInt32(static_cast<uint32_t>(value.size()));
+    writeBytes(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+}
+
+void CImageWriter::writeBytes(const uint8_t *data, size_t size)
+{
+    mData.insert(mData.end(), data, data + size);
+}
+
+const std::vector<uint8_t> &CImageWriter::getData() const
+{
+    return mData;
+}
+
+void CImageWriter::writeInteger(uint64_t value, size_t size)
+{
+    for (size_t byte = 0; byte < size; byte++) {
+
+        mData.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+    }
+}
+
+// Reader
+CImageReader::CImageReader(const uint8_t *data, size_t size, std::shared_ptr<const void> owner)
+    : mData(data), mSize(size), mOwner(std::move(owner))
+{
+}
+
+uint8_t CImageReader::readUInt8()
+{
+    return static_cast<uint8_t>(readInteger(sizeof(uint8_t)));
+}
+
+uint32_t CImageReader::readUInt32()
+{
+    return static_cast<uint32_t>(readInteger(sizeof(uint32_t)));
+}
+
+uint64_t CImageReader::readUInt64()
+{
+    return readInteger(sizeof(uint64_t));
+}
+
+double CImageReader::readDouble()
+{
+    uint64_t bits = readUInt64();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+string CImageReader::readString()
+{
+    string value;
+    readString(value);
+
+    return value;
+}
+
+void CImageReader::readString(string &value)
+{
+    size_t size = readUInt32();
+    const uint8_t *characters = readBytes(size);
+
+    if (characters == NULL) {
+
+        value.clear();
+        return;
+    }
+    value.assign(reinterpret_cast<const char *>(characters), size);
+}
+
+const uint8_t *CImageReader::readBytes(size_t size)
+{
+    if (mFailed || size > mSize - mPosition) {
+
+        mFailed = true;
+        return NULL;
+    }
+    const uint8_t *bytes = mData + mPosition;
+    mPosition += size;
+
+    return bytes;
+}
+
+bool CImageReader::hasFailed() const
+{
+    return mFailed;
+}
+
+bool CImageReader::isAtEnd() const
+{
+    return mPosition == mSize;
+}
+
+const std::shared_ptr<const void> &CImageReader::getOwner() const
+{
+    return mOwner;
+}
+
+uint64_t CImageReader::readInteger(size_t size)
+{
+    const uint8_t *bytes = readBytes(size);
+    uint64_t value = 0;
+
+    if (bytes == NULL) {
+
+        return 0;
+    }
+    for (size_t byte = 0; byte < size; byte++) {
+
+        value |= static_cast<uint64_t>(bytes[byte]) << (8 * byte);
+    }
+    return value;
+}
+
+// Files
+namespace
+{
+
+/** Files may be referred to by a local file URI */
+string toFilePath(const string &path)
+{
+    const string fileScheme = "file://";
+
+    if (path.compare(0, fileScheme.size(), fileScheme) == 0) {
+
+        return path.substr(fileScheme.size());
+    }
+    return path;
+}
+
+/** Version of a file, as told by its metadata
+ *
+ * A file rewritten within the timestamp resolution with the same size keeps its stamp: images
+ * record what they were built from, so a stale content fails to load and is rebuilt.
+ */
+struct Stamp
+{
+    bool operator==(const Stamp &other) const
+    {
+        return device == other.device && inode == other.inode && size == other.size &&
+               modification == other.modification;
+    }
+
+    uint64_t device{0};
+    uint64_t inode{0};
+    uint64_t size{0};
+    int64_t modification{0};
+};
+
+bool getStamp(const string &path, Stamp &stamp)
+{
+    struct stat status;
+    if (stat(toFilePath(path).c_str(), &status) != 0) {
+
+        return false;
+    }
+    stamp.device = status.st_dev;
+    stamp.inode = status.st_ino;
+    stamp.size = status.st_size;
+    stamp.modification = status.st_mtime;
+
+    return true;
+}
+
+/** Content read from a file, alive as long as one of its readers */
+struct SharedContent
+{
+    std::weak_ptr<const std::vector<uint8_t>> content;
+    Stamp stamp;
+};
+
+/** Contents alive in the process, by path */
+std::mutex gSharedContentsMutex;
+std::map<string, SharedContent> gSharedContents;
+
+} // namespace
+
+uint64_t CImageFile::hash(const uint8_t *data, size_t size)
+{
+    const uint64_t prime = 0x100000001b3;
+    uint64_t value = 0xcbf29ce484222325;
+    size_t index = 0;
+
+    // Whole words first: images are hashed on load, byte per byte is too slow for large ones
+    for (; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t)) {
+
+        uint64_t word = 0;
+        for (size_t byte = 0; byte < sizeof(uint64_t); byte++) {
+
+            word |= static_cast<uint64_t>(data[index + byte]) << (8 * byte);
+        }
+        value ^= word;
+        value *= prime;
+        // The multiplication only carries upwards, fold the high bits back
+        value ^= value >> 32;
+    }
+    for (; index < size; index++) {
+
+        value ^= data[index];
+        value *= prime;
+    }
+    return value;
+}
+
+bool CImageFile::hashFile(const string &path, uint64_t &fileHash, string &error)
+{
+    if (path.empty()) {
+
+        fileHash = 0;
+        return true;
+    }
+    std::vector<uint8_t> content;
+    if (!read(path, content, error)) {
+
+        return false;
+    }
+    fileHash = hash(content.data(), content.size());
+
+    return true;
+}
+
+bool CImageFile::hashStamp(const string &path, uint64_t &stampHash, string &error)
+{
+    Stamp stamp;
+    if (!getStamp(path, stamp)) {
+
+        error = "Unable to get the status of \"" + path + "\": " + strerror(errno);
+        return false;
+    }
+    CImageWriter fields;
+    fields.writeUInt64(stamp.device);
+    fields.writeUInt64(stamp.inode);
+    fields.writeUInt64(stamp.size);
+    fields.writeUInt64(static_cast<uint64_t>(stamp.modification));
+
+    stampHash = hash(fields.getData().data(), fields.getData().size());
+    return true;
+}
+
+bool CImageFile::read(const string &path, std::vector<uint8_t> &content, string &error)
+{
+    std::ifstream input(toFilePath(path).c_str(), std::ios::binary);
+
+    if (!input) {
+
+        error = "Unable to open \"" + path + "\" for reading";
+        return false;
+    }
+    // Read at once, images are large enough for a per character copy to matter
+    input.seekg(0, std::ios::end);
+    std::streamoff size = input.tellg();
+    input.seekg(0, std::ios::beg);
+
+    content.resize(size > 0 ? static_cast<size_t>(size) : 0);
+    input.read(reinterpret_cast<char *>(content.data()),
+               static_cast<std::streamsize>(content.size()));
+
+    if (size < 0 || !input) {
+
+        error = "Unable to read \"" + path + "\"";
+        return false;
+    }
+    return true;
+}
+
+bool CImageFile::readShared(const string &path,
+                            std::shared_ptr<const std::vector<uint8_t>> &content, string &error)
+{
+    // Taken before reading: a file changing meanwhile is read again by the next reader
+    Stamp stamp;
+    bool stamped = getStamp(path, stamp);
+    if (stamped) {
+
+        std::lock_guard<std::mutex> lock(gSharedContentsMutex);
+        auto shared = gSharedContents.find(path);
+        if (shared != gSharedContents.end() && shared->second.stamp == stamp) {
+
+            content = shared->second.content.lock();
+            if (content != nullptr) {
+
+                return true;
+            }
+        }
+    }
+    std::vector<uint8_t> fileContent;
+    if (!read(path, fileContent, error)) {
+
+        return false;
+    }
+    content = std::make_shared<const std::vector<uint8_t>>(std::move(fileContent));
+
+    std::lock_guard<std::mutex> lock(gSharedContentsMutex);
+
+    // Forget the released contents
+    for (auto it = gSharedContents.begin(); it != gSharedContents.end();) {
+
+        it = it->second.content.expired() ? gSharedContents.erase(it) : std::next(it);
+    }
+    if (stamped) {
+
+        gSharedContents[path] = {content, stamp};
+    }
+    return true;
+}
+
+bool CImageFile::write(const string &path, const std::vector<uint8_t> &content, string &error)
+{
+    {
+        // The shared content of the file is outdated, whatever its stamp
+        std::lock_guard<std::mutex> lock(gSharedContentsMutex);
+        gSharedContents.erase(path);
+    }
+    std::ofstream output(toFilePath(path).c_str(), std::ios::binary | std::ios::trunc);
+
+    if (!output) {
+
+        error = "Unable to open \"" + path + "\" for writing";
+        return false;
+    }
+    output.write(reinterpret_cast<const char *>(content.data()), content.size());
+    output.close();
+
+    if (!output) {
+
+        error = "Unable to write \"" + path + "\"";
+        return false;
+    }
+    return true;
+}
+
+bool CImageFile::remove(const string &path, string &error)
+{
+    {
+        // The shared content of the file is outdated
+        std::lock_guard<std::mutex> lock(gSharedContentsMutex);
+        gSharedContents.erase(path);
+    }
+    if (std::remove(toFilePath(path).c_str()) != 0 && errno != ENOENT) {
+
+        error = "Unable to remove \"" + path + "\": " + strerror(errno);
+        return false;
+    }
+    return true;
+}
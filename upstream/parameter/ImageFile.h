@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Serializes values into a binary image, in little endian */
+class CImageWriter
+{
+public:
+    void writeUInt8(uint8_t value);
+    void writeUInt32(uint32_t value);
+    void writeUInt64(uint64_t value);
+    void writeDouble(double value);
+    void writeString(const std::string &value);
+    void writeBytes(const uint8_t *data, size_t size);
+
+    const std::vector<uint8_t> &getData() const;
+
+private:
+    void writeInteger(uint64_t value, size_t size);
+
+    std::vector<uint8_t> mData;
+};
+
+/** Deserializes values from a binary image
+ *
+ * Reading past the end of the image does not throw: the read values are then zero or empty
+ * and the reader is marked as failed until its destruction.
+ */
+class CImageReader
+{
+public:
+    /** @param[in] owner keeps the image data alive, if the data is to outlive the reader */
+    CImageReader(const uint8_t *data, size_t size, std::shared_ptr<const void> owner = nullptr);
+
+    uint8_t readUInt8();
+    uint32_t readUInt32();
+    uint64_t readUInt64();
+    double readDouble();
+    std::string readString();
+    /** Read a string into an existing one, reusing its storage */
+    void readString(std::string &value);
+
+    /** @return the location of the next size bytes, NULL if the image is too short */
+    const uint8_t *readBytes(size_t size);
+
+    /** @return true if a read went past the end of the image */
+    bool hasFailed() const;
+
+    /** @return true if the whole image has been read */
+    bool isAtEnd() const;
+
+    /** @return the owner of the image data, empty if the data does not outlive the reader */
+    const std::shared_ptr<const void> &getOwner() const;
+
+private:
+    uint64_t readInteger(size_t size);
+
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mPosition{0};
+    bool mFailed{false};
+    std::shared_ptr<const void> mOwner;
+};
+
+/** Binary image file helpers */
+class CImageFile
+{
+public:
+    /** 64 bit hash: FNV-1a of the little endian 64 bit words of the data, then of its
+     * remaining bytes */
+    static uint64_t hash(const uint8_t *data, size_t size);
+
+    /** Hash a file content, an empty path hashes to 0 */
+    static bool hashFile(const std::string &path, uint64_t &fileHash, std::string &error);
+
+    /** Hash the stamp of a file: its device, inode, size and modification time
+     *
+     * Unlike hashFile, the file content is not read.
+     */
+    static bool hashStamp(const std::string &path, uint64_t &stampHash, std::string &error);
+
+    static bool read(const std::string &path, std::vector<uint8_t> &content, std::string &error);
+
+    /** Read a file, sharing its content with the other readers of the same file in the process
+     *
+     * As long as a content read from a path is alive, reading the path again gives that same
+     * content if the file size, modification time and inode did not change, instead of a copy.
+     * The file is then not read again. Writing the file with write() discards its content.
+     */
+    static bool readShared(const std::string &path,
+                           std::shared_ptr<const std::vector<uint8_t>> &content,
+                           std::string &error);
+
+    static bool write(const std::string &path, const std::vector<uint8_t> &content,
+                      std::string &error);
+
+    /** Remove a file, a file already missing is not an error */
+    static bool remove(const std::string &path, std::string &error);
+};
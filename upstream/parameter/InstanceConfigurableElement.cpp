@@ -33,6 +33,7 @@
 #include "Syncer.h"
 #include "TypeElement.h"
 #include "ParameterAccessContext.h"
+#include "Arena.h"
 #include <assert.h>
 
 #define base CConfigurableElement
@@ -43,6 +44,21 @@ CInstanceConfigurableElement::CInstanceConfigurableElement(const std::string &st
 {
 }
 
+void *CInstanceConfigurableElement::operator new(size_t size, utility::Arena &arena)
+{
+    return arena.allocate(size);
+}
+
+void CInstanceConfigurableElement::operator delete(void * /*pInstance*/, utility::Arena & /*arena*/)
+{
+    // Freed with the arena
+}
+
+void CInstanceConfigurableElement::operator delete(void * /*pInstance*/)
+{
+    // Freed with the arena
+}
+
 std::string CInstanceConfigurableElement::getKind() const
 {
     // Delegate
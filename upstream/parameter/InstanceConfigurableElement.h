@@ -56,6 +56,14 @@ public:
 
     CInstanceConfigurableElement(const std::string &strName, const CTypeElement *pTypeElement);
 
+    /** Instances are allocated in the arena of their system class, see CTypeElement::instantiate.
+     *
+     * Deleting an instance runs its destructor, its memory is only freed with the arena.
+     */
+    static void *operator new(size_t size, utility::Arena &arena);
+    static void operator delete(void *pInstance, utility::Arena &arena);
+    static void operator delete(void *pInstance);
+
     // Instantiated type
     const CTypeElement *getTypeElement() const;
 
@@ -76,6 +84,8 @@ public:
     // Syncer to/from HW
     void setSyncer(ISyncer *pSyncer);
     void unsetSyncer();
+    // Syncer (me or ascendant)
+    virtual ISyncer *getSyncer() const;
 
     // Type
     virtual Type getType() const = 0;
@@ -96,8 +106,6 @@ public:
                                 CXmlSerializingContext &serializingContext) const;
 
 protected:
-    // Syncer
-    virtual ISyncer *getSyncer() const;
     // Syncer set (descendant)
     virtual void fillSyncerSetFromDescendant(CSyncerSet &syncerSet) const;
 
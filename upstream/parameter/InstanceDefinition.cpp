@@ -42,7 +42,7 @@ bool CInstanceDefinition::childrenAreDynamic() const
     return true;
 }
 
-CInstanceConfigurableElement *CInstanceDefinition::doInstantiate() const
+CInstanceConfigurableElement *CInstanceDefinition::doInstantiate(utility::Arena & /*arena*/) const
 {
     // Element not supposed to be instantiated direcly
     assert(0);
@@ -50,7 +50,7 @@ CInstanceConfigurableElement *CInstanceDefinition::doInstantiate() const
     return NULL;
 }
 
-void CInstanceDefinition::createInstances(CElement *pFatherElement)
+void CInstanceDefinition::createInstances(CElement *pFatherElement, utility::Arena &arena) const
 {
-    populate(pFatherElement);
+    populate(pFatherElement, arena);
 }
@@ -36,11 +36,11 @@
 class CInstanceDefinition : public CTypeElement
 {
 public:
-    void createInstances(CElement *pFatherElement);
+    void createInstances(CElement *pFatherElement, utility::Arena &arena) const;
 
     virtual std::string getKind() const;
 
 private:
     virtual bool childrenAreDynamic() const;
-    virtual CInstanceConfigurableElement *doInstantiate() const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
 };
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "IntegerParameterType.h"
+#include "ImageFile.h"
 #include <stdlib.h>
 #include <sstream>
 #include <iomanip>
@@ -35,6 +36,7 @@
 #include <assert.h>
 #include "ParameterAdaptation.h"
 #include "Utility.h"
+#include "convert.hpp"
 #include <errno.h>
 
 #define base CParameterType
@@ -137,6 +139,29 @@ bool CIntegerParameterType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CIntegerParameterType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt8(_bSigned);
+    writer.writeUInt32(_uiMin);
+    writer.writeUInt32(_uiMax);
+}
+
+bool CIntegerParameterType::propertiesFromImage(CImageReader &reader,
+                                                const CComponentLibrary &componentLibrary,
+                                                std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _bSigned = reader.readUInt8() != 0;
+    _uiMin = reader.readUInt32();
+    _uiMax = reader.readUInt32();
+    return true;
+}
+
 // Conversion (tuning)
 bool CIntegerParameterType::toBlackboard(const string &strValue, uint32_t &uiValue,
                                          CParameterAccessContext &parameterAccessContext) const
@@ -186,15 +211,11 @@ bool CIntegerParameterType::fromBlackboard(string &strValue, const uint32_t &val
     // Check unsigned value is encodable
     assert(isEncodable(value, false));
 
-    // Format
-    ostringstream stream;
-
     // Take care of format
     if (parameterAccessContext.valueSpaceIsRaw() && parameterAccessContext.outputRawFormatIsHex()) {
 
         // Hexa display with unecessary bits cleared out
-        stream << "0x" << std::hex << std::uppercase << std::setw(static_cast<int>(getSize() * 2))
-               << std::setfill('0') << value;
+        strValue = toHexString(value, getSize() * 2);
     } else {
 
         if (_bSigned) {
@@ -204,15 +225,13 @@ bool CIntegerParameterType::fromBlackboard(string &strValue, const uint32_t &val
             // Sign extend
             signExtend(iValue);
 
-            stream << iValue;
+            strValue = std::to_string(iValue);
         } else {
 
-            stream << value;
+            strValue = std::to_string(value);
         }
     }
 
-    strValue = stream.str();
-
     return true;
 }
 
@@ -352,6 +371,17 @@ uint32_t CIntegerParameterType::getDefaultValue() const
     return _uiMin;
 }
 
+// Range
+uint32_t CIntegerParameterType::getMin() const
+{
+    return _uiMin;
+}
+
+uint32_t CIntegerParameterType::getMax() const
+{
+    return _uiMax;
+}
+
 int CIntegerParameterType::toPlainInteger(int iSizeOptimizedData) const
 {
     if (_bSigned) {
@@ -44,6 +44,11 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
@@ -72,6 +77,10 @@ public:
     // Default value handling (simulation only)
     virtual uint32_t getDefaultValue() const;
 
+    // Range, sign extended for signed types
+    uint32_t getMin() const;
+    uint32_t getMax() const;
+
     // Element properties
     virtual void showProperties(std::string &strResult) const;
 
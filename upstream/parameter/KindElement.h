@@ -30,6 +30,7 @@
 #pragma once
 
 #include "Element.h"
+#include "InternedString.h"
 
 #include <string>
 
@@ -37,11 +38,11 @@ class CKindElement : public CElement
 {
 public:
     CKindElement(const std::string &strName, const std::string &strKind)
-        : CElement(strName), _strKind(strKind)
+        : CElement(strName), _kind(strKind)
     {
     }
 
-    virtual std::string getKind() const { return _strKind; }
+    virtual std::string getKind() const { return _kind.str(); }
 private:
-    std::string _strKind;
+    utility::InternedString _kind;
 };
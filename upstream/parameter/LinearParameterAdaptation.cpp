@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "LinearParameterAdaptation.h"
+#include "ImageFile.h"
 
 #define base CParameterAdaptation
 
@@ -78,6 +79,27 @@ bool CLinearParameterAdaptation::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CLinearParameterAdaptation::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeDouble(_dSlopeNumerator);
+    writer.writeDouble(_dSlopeDenominator);
+}
+
+bool CLinearParameterAdaptation::propertiesFromImage(CImageReader &reader,
+                                                     const CComponentLibrary &componentLibrary,
+                                                     std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _dSlopeNumerator = reader.readDouble();
+    _dSlopeDenominator = reader.readDouble();
+    return true;
+}
+
 // Conversions
 int64_t CLinearParameterAdaptation::fromUserValue(double dValue) const
 {
@@ -29,6 +29,7 @@
  */
 
 #include "LogarithmicParameterAdaptation.h"
+#include "ImageFile.h"
 #include <cmath>
 #include <limits>
 #include <algorithm>
@@ -73,6 +74,27 @@ bool CLogarithmicParameterAdaptation::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CLogarithmicParameterAdaptation::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeDouble(_dLogarithmBase);
+    writer.writeDouble(_dFloorValue);
+}
+
+bool CLogarithmicParameterAdaptation::propertiesFromImage(CImageReader &reader,
+                                                          const CComponentLibrary &componentLibrary,
+                                                          std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _dLogarithmBase = reader.readDouble();
+    _dFloorValue = reader.readDouble();
+    return true;
+}
+
 int64_t CLogarithmicParameterAdaptation::fromUserValue(double value) const
 {
     return std::max(base::fromUserValue(log(value) / log(_dLogarithmBase)),
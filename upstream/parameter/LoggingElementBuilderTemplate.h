@@ -90,6 +90,11 @@ public:
         return new ElementType(details::getName(xmlElement), mLogger);
     }
 
+    CElement *createNamedElement(const std::string &name) const override
+    {
+        return new ElementType(name, mLogger);
+    }
+
 private:
     /** Application Logger */
     core::log::Logger &mLogger;
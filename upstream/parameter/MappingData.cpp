@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "MappingData.h"
+#include "ImageFile.h"
 #include "Tokenizer.h"
 #include "Utility.h"
 #include <assert.h>
@@ -77,7 +78,7 @@ bool CMappingData::getValue(const std::string &strkey, const std::string *&pStrV
 
     if (it != _keyToValueMap.end()) {
 
-        pStrValue = &it->second;
+        pStrValue = &it->second.str();
 
         return true;
     }
@@ -86,7 +87,44 @@ bool CMappingData::getValue(const std::string &strkey, const std::string *&pStrV
 
 std::string CMappingData::asString() const
 {
-    return utility::asString(_keyToValueMap, ", ", ":");
+    std::map<std::string, std::string> keyToValueMap;
+
+    for (const auto &keyToValue : _keyToValueMap) {
+
+        keyToValueMap[keyToValue.first] = keyToValue.second.str();
+    }
+    return utility::asString(keyToValueMap, ", ", ":");
+}
+
+void CMappingData::toImage(CImageWriter &writer) const
+{
+    writer.writeUInt32(static_cast<uint32_t>(_keyToValueMap.size()));
+
+    for (const auto &keyToValue : _keyToValueMap) {
+
+        writer.writeString(keyToValue.first);
+        writer.writeString(keyToValue.second.str());
+    }
+}
+
+bool CMappingData::fromImage(CImageReader &reader, std::string &error)
+{
+    size_t nbValues = reader.readUInt32();
+    std::string strKey;
+    std::string strValue;
+
+    for (size_t value = 0; value < nbValues && !reader.hasFailed(); value++) {
+
+        reader.readString(strKey);
+        reader.readString(strValue);
+
+        if (!_keyToValueMap.emplace(strKey, utility::InternedString(strValue)).second) {
+
+            error = "Duplicate Mapping data key " + strKey;
+            return false;
+        }
+    }
+    return true;
 }
 
 bool CMappingData::addValue(const std::string &strkey, const std::string &strValue)
@@ -95,7 +133,7 @@ bool CMappingData::addValue(const std::string &strkey, const std::string &strVal
 
         return false;
     }
-    _keyToValueMap[strkey] = strValue;
+    _keyToValueMap[strkey] = utility::InternedString(strValue);
 
     return true;
 }
@@ -29,12 +29,18 @@
  */
 #pragma once
 
+#include "InternedString.h"
+
 #include <string>
 #include <map>
 
+class CImageWriter;
+class CImageReader;
+
 class CMappingData
 {
-    typedef std::map<std::string, std::string>::const_iterator KeyToValueMapConstIterator;
+    typedef std::map<std::string, utility::InternedString>::const_iterator
+        KeyToValueMapConstIterator;
 
 public:
     /** Initialize mapping data through a raw value
@@ -56,8 +62,13 @@ public:
      */
     std::string asString() const;
 
+    // Structure image
+    void toImage(CImageWriter &writer) const;
+    bool fromImage(CImageReader &reader, std::string &error);
+
 private:
     bool addValue(const std::string &strkey, const std::string &strValue);
 
-    std::map<std::string, std::string> _keyToValueMap;
+    // Values are interned as types of different subsystems often share them
+    std::map<std::string, utility::InternedString> _keyToValueMap;
 };
@@ -39,4 +39,9 @@ public:
     {
         return new ElementType(xmlElement.getNameAttribute());
     }
+
+    CElement *createNamedElement(const std::string &name) const override
+    {
+        return new ElementType(name);
+    }
 };
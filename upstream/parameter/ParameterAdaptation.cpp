@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ParameterAdaptation.h"
+#include "ImageFile.h"
 
 #define base CElement
 
@@ -72,6 +73,25 @@ bool CParameterAdaptation::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CParameterAdaptation::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt32(static_cast<uint32_t>(_iOffset));
+}
+
+bool CParameterAdaptation::propertiesFromImage(CImageReader &reader,
+                                               const CComponentLibrary &componentLibrary,
+                                               std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _iOffset = static_cast<int32_t>(reader.readUInt32());
+    return true;
+}
+
 // Conversions
 int64_t CParameterAdaptation::fromUserValue(double dValue) const
 {
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ParameterBatch.h"
+#include "ParameterAccessContext.h"
+#include "BaseParameter.h"
+#include "ParameterBlackboard.h"
+#include "ParameterMgr.h"
+#include "Syncer.h"
+
+#include <algorithm>
+#include <mutex>
+
+using std::string;
+using std::mutex;
+using std::lock_guard;
+
+ParameterBatch::Access &ParameterBatch::add(const ElementHandle &handle, bool isSet,
+                                            Access::Type type)
+{
+    mAccesses.emplace_back();
+    Access &access = mAccesses.back();
+    access.handle = &handle;
+    access.isSet = isSet;
+    access.type = type;
+    access.destination = nullptr;
+    return access;
+}
+
+// Sets
+void ParameterBatch::setAsBoolean(const ElementHandle &handle, bool value)
+{
+    add(handle, true, Access::EBoolean).value.boolean = value;
+}
+
+void ParameterBatch::setAsInteger(const ElementHandle &handle, uint32_t value)
+{
+    add(handle, true, Access::EInteger).value.integer = value;
+}
+
+void ParameterBatch::setAsSignedInteger(const ElementHandle &handle, int32_t value)
+{
+    add(handle, true, Access::ESignedInteger).value.signedInteger = value;
+}
+
+void ParameterBatch::setAsDouble(const ElementHandle &handle, double value)
+{
+    add(handle, true, Access::EDouble).value.floating = value;
+}
+
+void ParameterBatch::setAsString(const ElementHandle &handle, const string &value)
+{
+    add(handle, true, Access::EString).string = value;
+}
+
+// Gets
+void ParameterBatch::getAsBoolean(const ElementHandle &handle, bool &value)
+{
+    add(handle, false, Access::EBoolean).destination = &value;
+}
+
+void ParameterBatch::getAsInteger(const ElementHandle &handle, uint32_t &value)
+{
+    add(handle, false, Access::EInteger).destination = &value;
+}
+
+void ParameterBatch::getAsSignedInteger(const ElementHandle &handle, int32_t &value)
+{
+    add(handle, false, Access::ESignedInteger).destination = &value;
+}
+
+void ParameterBatch::getAsDouble(const ElementHandle &handle, double &value)
+{
+    add(handle, false, Access::EDouble).destination = &value;
+}
+
+void ParameterBatch::getAsString(const ElementHandle &handle, string &value)
+{
+    add(handle, false, Access::EString).destination = &value;
+}
+
+size_t ParameterBatch::size() const
+{
+    return mAccesses.size();
+}
+
+void ParameterBatch::clear()
+{
+    mAccesses.clear();
+}
+
+bool ParameterBatch::perform(const Access &access, CParameterAccessContext &context) const
+{
+    const auto &parameter = static_cast<const CBaseParameter &>(access.handle->mElement);
+
+    if (!access.isSet) {
+
+        switch (access.type) {
+        case Access::EBoolean:
+            return parameter.access(*static_cast<bool *>(access.destination), false, context);
+        case Access::EInteger:
+            return parameter.access(*static_cast<uint32_t *>(access.destination), false, context);
+        case Access::ESignedInteger:
+            return parameter.access(*static_cast<int32_t *>(access.destination), false, context);
+        case Access::EDouble:
+            return parameter.access(*static_cast<double *>(access.destination), false, context);
+        case Access::EString:
+            return parameter.access(*static_cast<string *>(access.destination), false, context);
+        }
+        return false;
+    }
+    // BaseParameter::access takes a non-const argument - therefore we need to copy the value
+    auto value = access.value;
+
+    switch (access.type) {
+    case Access::EBoolean:
+        return parameter.access(value.boolean, true, context);
+    case Access::EInteger:
+        return parameter.access(value.integer, true, context);
+    case Access::ESignedInteger:
+        return parameter.access(value.signedInteger, true, context);
+    case Access::EDouble:
+        return parameter.access(value.floating, true, context);
+    case Access::EString:
+        mStringCopy = access.string;
+        return parameter.access(mStringCopy, true, context);
+    }
+    return false;
+}
+
+void ParameterBatch::restore(CParameterBlackboard &blackboard) const
+{
+    // Backwards, as a parameter may have been set several times
+    size_t end = mPreviousSettings.size();
+
+    for (auto it = mSetParameters.rbegin(); it != mSetParameters.rend(); ++it) {
+
+        size_t size = (*it)->getFootPrint();
+
+        end -= size;
+        blackboard.writeBuffer(&mPreviousSettings[end], size, (*it)->getOffset());
+    }
+}
+
+bool ParameterBatch::apply(string &error) const
+{
+    if (mAccesses.empty()) {
+
+        return true;
+    }
+    CParameterMgr &parameterMgr = mAccesses.front().handle->mParameterMgr;
+
+    // Validate all the accesses before any of them is done
+    for (auto &access : mAccesses) {
+
+        if (&access.handle->mParameterMgr != &parameterMgr) {
+
+            error = "Can not batch the parameters of different parameter frameworks";
+            return false;
+        }
+        if (not(access.isSet ? access.handle->checkSetValidity(0, error)
+                             : access.handle->checkGetValidity(false, error))) {
+            return false;
+        }
+    }
+    // When in tuning mode, silently skip "set" requests
+    bool skipSets = parameterMgr.tuningModeOn();
+
+    // Ensure we're safe against blackboard foreign access
+    lock_guard<mutex> autoLock(parameterMgr.getBlackboardMutex());
+
+    CParameterBlackboard *blackboard = parameterMgr.getParameterBlackboard();
+
+    // Synchronize once all the sets are done
+    CParameterAccessContext parameterAccessContext(error, blackboard);
+    parameterAccessContext.setAutoSync(false);
+
+    mSyncers.clear();
+    mPreviousSettings.clear();
+    mSetParameters.clear();
+
+    for (auto &access : mAccesses) {
+
+        const auto &parameter = static_cast<const CBaseParameter &>(access.handle->mElement);
+
+        if (access.isSet) {
+
+            if (skipSets) {
+
+                continue;
+            }
+            ISyncer *syncer = parameter.getSyncer();
+
+            if (syncer == nullptr) {
+
+                error = "Unable to synchronize modification. No Syncer object associated to "
+                        "configurable element: " +
+                        parameter.getPath();
+                restore(*blackboard);
+                return false;
+            }
+            if (std::find(mSyncers.begin(), mSyncers.end(), syncer) == mSyncers.end()) {
+
+                mSyncers.push_back(syncer);
+            }
+            size_t size = parameter.getFootPrint();
+
+            mPreviousSettings.resize(mPreviousSettings.size() + size);
+            blackboard->readBuffer(&mPreviousSettings[mPreviousSettings.size() - size], size,
+                                   parameter.getOffset());
+            mSetParameters.push_back(&parameter);
+        }
+        if (!perform(access, parameterAccessContext)) {
+
+            restore(*blackboard);
+            return false;
+        }
+    }
+    for (size_t synced = 0; synced < mSyncers.size(); synced++) {
+
+        if (!mSyncers[synced]->sync(*blackboard, false, error)) {
+
+            // Put the hardware of the syncers reached so far back to the restored values
+            restore(*blackboard);
+
+            for (size_t resynced = 0; resynced <= synced; resynced++) {
+
+                string resyncError;
+                if (!mSyncers[resynced]->sync(*blackboard, false, resyncError)) {
+
+                    error += "; unable to restore the previous values: " + resyncError;
+                }
+            }
+            return false;
+        }
+    }
+    return true;
+}
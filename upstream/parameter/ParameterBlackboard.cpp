@@ -31,22 +31,141 @@
 #include "Iterator.hpp"
 #include "AlwaysAssert.hpp"
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+
+/** Pool size under which released payload entries are not worth purging. */
+const size_t gMinPurgeThreshold = 256;
+
+/** Granularity of the modification tracking, a cache line. */
+const size_t gEpochBlockSize = 64;
+
+size_t getBlockCount(size_t size)
+{
+    return (size + gEpochBlockSize - 1) / gEpochBlockSize;
+}
+
+/** Process wide pool of immutable blackboard contents, indexed by content hash.
+ *
+ * The pool does not own the payloads: they are released as soon as the last blackboard
+ * sharing them is written to or destroyed.
+ */
+class PayloadPool
+{
+public:
+    using Blackboard = std::vector<uint8_t>;
+    using Payload = std::shared_ptr<const Blackboard>;
+
+    static PayloadPool &get()
+    {
+        static PayloadPool pool;
+        return pool;
+    }
+
+    /** Find a payload identical to the given content, or create one from it. */
+    Payload intern(Blackboard &&content)
+    {
+        size_t hash = hashOf(content);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto range = mPayloads.equal_range(hash);
+        for (auto it = range.first; it != range.second;) {
+
+            Payload candidate = it->second.lock();
+            if (!candidate) {
+
+                it = mPayloads.erase(it);
+                continue;
+            }
+            if (*candidate == content) {
+
+                return candidate;
+            }
+            ++it;
+        }
+
+        if (mPayloads.size() >= mPurgeThreshold) {
+
+            purge();
+        }
+
+        Payload payload = std::make_shared<const Blackboard>(std::move(content));
+        mPayloads.emplace(hash, payload);
+
+        return payload;
+    }
+
+private:
+    // FNV-1a
+    static size_t hashOf(const Blackboard &content)
+    {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (uint8_t byte : content) {
+
+            hash = (hash ^ byte) * 1099511628211ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    /** Forget released payloads, whose entries are otherwise only dropped on hash collision. */
+    void purge()
+    {
+        for (auto it = mPayloads.begin(); it != mPayloads.end();) {
+
+            if (it->second.expired()) {
+
+                it = mPayloads.erase(it);
+            } else {
+
+                ++it;
+            }
+        }
+        mPurgeThreshold = std::max(gMinPurgeThreshold, 2 * mPayloads.size());
+    }
+
+    std::mutex mMutex;
+    std::unordered_multimap<size_t, std::weak_ptr<const Blackboard>> mPayloads;
+    size_t mPurgeThreshold{gMinPurgeThreshold};
+};
+
+} // namespace
 
 // Size
 void CParameterBlackboard::setSize(size_t size)
 {
-    mBlackboard.resize(size);
+    if (mTrackModifications) {
+
+        mBlockEpochs.resize(getBlockCount(size));
+    }
+    if (size == getSize()) {
+
+        return;
+    }
+    if (size == 0) {
+
+        // Releasing the content does not need a private copy of it
+        mSharedBlackboard.reset();
+        Blackboard().swap(mBlackboard);
+        return;
+    }
+    exclusiveContent().resize(size);
 }
 
 size_t CParameterBlackboard::getSize() const
 {
-    return mBlackboard.size();
+    return content().size();
 }
 
 // Single parameter access
 void CParameterBlackboard::writeInteger(const void *pvSrcData, size_t size, size_t offset)
 {
     assertValidAccess(offset, size);
+    trackWrite(static_cast<const uint8_t *>(pvSrcData), size, offset);
 
     auto first = MAKE_ARRAY_ITERATOR(static_cast<const uint8_t *>(pvSrcData), size);
     auto last = first + size;
@@ -69,6 +188,7 @@ void CParameterBlackboard::readInteger(void *pvDstData, size_t size, size_t offs
 void CParameterBlackboard::writeString(const std::string &input, size_t offset)
 {
     assertValidAccess(offset, input.size() + 1);
+    trackWrite(reinterpret_cast<const uint8_t *>(input.c_str()), input.size() + 1, offset);
 
     auto dest_last = std::copy(begin(input), end(input), atOffset(offset));
     *dest_last = '\0';
@@ -81,7 +201,7 @@ void CParameterBlackboard::readString(std::string &output, size_t offset) const
     assertValidAccess(offset, sizeof('\0'));
 
     // Get the pointer to the null terminated string
-    const uint8_t *first = &mBlackboard[offset];
+    const uint8_t *first = &content()[offset];
     output = reinterpret_cast<const char *>(first);
 }
 
@@ -98,6 +218,7 @@ void CParameterBlackboard::readBuffer(void *pvDstData, size_t size, size_t offse
 void CParameterBlackboard::writeBytes(const std::vector<uint8_t> &bytes, size_t offset)
 {
     assertValidAccess(offset, bytes.size());
+    trackWrite(bytes.data(), bytes.size(), offset);
 
     std::copy(begin(bytes), end(bytes), atOffset(offset));
 }
@@ -113,24 +234,185 @@ void CParameterBlackboard::readBytes(std::vector<uint8_t> &bytes, size_t offset)
 uint8_t *CParameterBlackboard::getLocation(size_t offset)
 {
     assertValidAccess(offset, 1);
-    return &mBlackboard[offset];
+    return &exclusiveContent()[offset];
 }
 
 // Configuration handling
 void CParameterBlackboard::restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset)
 {
-    const auto &fromBB = pFromBlackboard->mBlackboard;
+    const auto &fromBB = pFromBlackboard->content();
     assertValidAccess(offset, fromBB.size());
+    trackWrite(fromBB.data(), fromBB.size(), offset);
+
+    if (offset == 0 && fromBB.size() == getSize() && pFromBlackboard->mSharedBlackboard) {
+
+        // Whole content replacement by a shared one, share it as well instead of copying
+        mSharedBlackboard = pFromBlackboard->mSharedBlackboard;
+        Blackboard().swap(mBlackboard);
+        return;
+    }
     std::copy(begin(fromBB), end(fromBB), atOffset(offset));
 }
 
 void CParameterBlackboard::saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const
 {
-    auto &toBB = pToBlackboard->mBlackboard;
+    auto &toBB = pToBlackboard->exclusiveContent();
     assertValidAccess(offset, toBB.size());
     std::copy_n(atOffset(offset), toBB.size(), begin(toBB));
 }
 
+// Content sharing
+void CParameterBlackboard::share()
+{
+    if (mSharedBlackboard || mBlackboard.empty()) {
+
+        return;
+    }
+    mSharedBlackboard = PayloadPool::get().intern(std::move(mBlackboard));
+    Blackboard().swap(mBlackboard);
+}
+
+const void *CParameterBlackboard::getSharedPayload() const
+{
+    return mSharedBlackboard.get();
+}
+
+// Comparison
+std::vector<utility::BytesSpan> CParameterBlackboard::diff(const CParameterBlackboard &other,
+                                                           size_t offset, size_t otherOffset,
+                                                           size_t size) const
+{
+    assertValidAccess(offset, size);
+    other.assertValidAccess(otherOffset, size);
+
+    if (offset == otherOffset && &content() == &other.content()) {
+
+        // Same shared payload
+        return {};
+    }
+    return utility::diffBytes(content().data() + offset, other.content().data() + otherOffset,
+                              size);
+}
+
+// Modification tracking
+void CParameterBlackboard::trackModifications()
+{
+    mTrackModifications = true;
+    mBlockEpochs.resize(getBlockCount(getSize()));
+}
+
+void CParameterBlackboard::suspendModificationTracking()
+{
+    // Unshare now, concurrent writers must not race to do it
+    exclusiveContent();
+
+    if (!mTrackModifications) {
+
+        return;
+    }
+    mTrackingSuspendedContent.reset(new Blackboard(content()));
+    mTrackModifications = false;
+}
+
+void CParameterBlackboard::resumeModificationTracking()
+{
+    if (!mTrackingSuspendedContent) {
+
+        return;
+    }
+    mTrackModifications = true;
+    stamp(mTrackingSuspendedContent->data(), content().data(), getSize(), 0);
+    mTrackingSuspendedContent.reset();
+}
+
+void CParameterBlackboard::markModified(size_t offset, size_t size)
+{
+    assertValidAccess(offset, size);
+
+    if (mTrackModifications && size != 0) {
+
+        ++mEpoch;
+        stampBlocks(offset, size);
+    }
+}
+
+uint64_t CParameterBlackboard::getEpoch() const
+{
+    return mEpoch;
+}
+
+std::vector<utility::BytesSpan> CParameterBlackboard::getModifiedSince(uint64_t epoch) const
+{
+    std::vector<utility::BytesSpan> spans;
+
+    for (size_t block = 0; block < mBlockEpochs.size(); block++) {
+
+        if (mBlockEpochs[block] <= epoch) {
+            continue;
+        }
+        size_t offset = block * gEpochBlockSize;
+        size_t size = std::min(gEpochBlockSize, getSize() - offset);
+
+        if (!spans.empty() && spans.back().offset + spans.back().size == offset) {
+
+            spans.back().size += size;
+        } else {
+
+            spans.push_back({offset, size});
+        }
+    }
+    return spans;
+}
+
+void CParameterBlackboard::trackWrite(const uint8_t *data, size_t size, size_t offset)
+{
+    if (mTrackModifications) {
+
+        // Only stamp actual changes, restoring identical settings is not a modification
+        stamp(content().data() + offset, data, size, offset);
+    }
+}
+
+void CParameterBlackboard::stamp(const uint8_t *previous, const uint8_t *current, size_t size,
+                                 size_t offset)
+{
+    // Walk the spans in place, writes are on access paths which must not allocate
+    utility::BytesSpan span;
+    bool stamped = false;
+
+    for (size_t index = 0; utility::nextDiffSpan(previous, current, size, index, span);
+         index = span.offset + span.size) {
+
+        if (!stamped) {
+
+            ++mEpoch;
+            stamped = true;
+        }
+        stampBlocks(offset + span.offset, span.size);
+    }
+}
+
+void CParameterBlackboard::stampBlocks(size_t offset, size_t size)
+{
+    size_t lastBlock = (offset + size - 1) / gEpochBlockSize;
+
+    for (size_t block = offset / gEpochBlockSize; block <= lastBlock; block++) {
+
+        mBlockEpochs[block] = mEpoch;
+    }
+}
+
+CParameterBlackboard::Blackboard &CParameterBlackboard::exclusiveContent()
+{
+    if (mSharedBlackboard) {
+
+        // Shared contents are immutable, write to a private copy
+        mBlackboard = *mSharedBlackboard;
+        mSharedBlackboard.reset();
+    }
+    return mBlackboard;
+}
+
 void CParameterBlackboard::assertValidAccess(size_t offset, size_t size) const
 {
     ALWAYS_ASSERT(offset + size <= getSize(),
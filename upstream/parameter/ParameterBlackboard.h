@@ -30,8 +30,10 @@
 #pragma once
 
 #include "NonCopyable.hpp"
+#include "BytesDiff.h"
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -89,12 +91,114 @@ public:
     void restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset);
     void saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const;
 
+    /**
+     * Share the blackboard content with identical blackboards.
+     *
+     * The content is moved to a process wide pool of immutable payloads, where identical byte
+     * sequences are stored once and reference counted. Any later write to the blackboard
+     * transparently makes a private copy of the content first (copy on write).
+     */
+    void share();
+
+    /**
+     * Get the shared payload backing the blackboard.
+     *
+     * @return an opaque identifier of the shared payload, the same for all blackboards sharing
+     *         it, or nullptr if the blackboard holds a private copy of its content.
+     */
+    const void *getSharedPayload() const;
+
+    /**
+     * List the bytes that differ from another blackboard.
+     *
+     * @param[in] other the blackboard to compare with.
+     * @param[in] offset the start of the compared range in this blackboard.
+     * @param[in] otherOffset the start of the compared range in the other blackboard.
+     * @param[in] size the size of both compared ranges.
+     * @return the differing spans, relative to the start of the compared ranges.
+     */
+    std::vector<utility::BytesSpan> diff(const CParameterBlackboard &other, size_t offset,
+                                         size_t otherOffset, size_t size) const;
+
+    /**
+     * Track the modifications of the blackboard content.
+     *
+     * Once enabled, each write or restore changing bytes increments the blackboard epoch and
+     * stamps the blocks of bytes it changed with the new epoch.
+     */
+    void trackModifications();
+
+    /**
+     * Stamp a range as modified.
+     *
+     * For writes the blackboard can not track, ie through getLocation.
+     *
+     * @param[in] offset the start of the modified range.
+     * @param[in] size the size of the modified range.
+     */
+    void markModified(size_t offset, size_t size);
+
+    /**
+     * Suspend the modification tracking, allowing concurrent writes to disjoint ranges.
+     *
+     * The content is unshared, and saved so that resuming the tracking stamps what changed
+     * in between.
+     */
+    void suspendModificationTracking();
+
+    /**
+     * Resume a suspended modification tracking.
+     *
+     * The bytes changed since the suspension are stamped as a single modification.
+     */
+    void resumeModificationTracking();
+
+    /** @return the current modification epoch, 0 if no tracked modification happened. */
+    uint64_t getEpoch() const;
+
+    /**
+     * List the ranges modified after an epoch.
+     *
+     * @param[in] epoch the epoch after which modifications are listed.
+     * @return the modified ranges in increasing order, with a block granularity.
+     */
+    std::vector<utility::BytesSpan> getModifiedSince(uint64_t epoch) const;
+
 private:
     void assertValidAccess(size_t offset, size_t size) const;
 
     using Blackboard = std::vector<uint8_t>;
     Blackboard mBlackboard;
 
-    Blackboard::iterator atOffset(size_t offset) { return begin(mBlackboard) + offset; }
-    Blackboard::const_iterator atOffset(size_t offset) const { return begin(mBlackboard) + offset; }
+    /** Immutable shared content, when set it replaces mBlackboard. */
+    std::shared_ptr<const Blackboard> mSharedBlackboard;
+
+    const Blackboard &content() const
+    {
+        return mSharedBlackboard ? *mSharedBlackboard : mBlackboard;
+    }
+    /** Get the content for writing, unsharing it first if needed. */
+    Blackboard &exclusiveContent();
+
+    /** Stamp the bytes of a write that differ from the current content, if tracking. */
+    void trackWrite(const uint8_t *data, size_t size, size_t offset);
+
+    /** Stamp the bytes that differ between previous and current, relative to offset, with a
+     * new epoch.
+     */
+    void stamp(const uint8_t *previous, const uint8_t *current, size_t size, size_t offset);
+
+    /** Stamp the blocks covering the given non empty range of bytes with the current epoch. */
+    void stampBlocks(size_t offset, size_t size);
+
+    /** Modification tracking state, last modification epoch of each block of bytes. */
+    bool mTrackModifications{false};
+    uint64_t mEpoch{0};
+    std::vector<uint64_t> mBlockEpochs;
+
+    /** Content when the tracking was suspended, empty if not suspended. */
+    std::unique_ptr<Blackboard> mTrackingSuspendedContent;
+
+    Blackboard::iterator atOffset(size_t offset) { return begin(exclusiveContent()) + offset; }
+    Blackboard::const_iterator atOffset(size_t offset) const { return begin(content()) + offset; }
 };
@@ -47,12 +47,12 @@ bool CParameterBlockType::childrenAreDynamic() const
     return true;
 }
 
-CInstanceConfigurableElement *CParameterBlockType::doInstantiate() const
+CInstanceConfigurableElement *CParameterBlockType::doInstantiate(utility::Arena &arena) const
 {
-    return new CParameterBlock(getName(), this);
+    return new (arena) CParameterBlock(getName(), this);
 }
 
-void CParameterBlockType::populate(CElement *pElement) const
+void CParameterBlockType::populate(CElement *pElement, utility::Arena &arena) const
 {
     size_t arrayLength = getArrayLength();
 
@@ -62,14 +62,14 @@ void CParameterBlockType::populate(CElement *pElement) const
         for (size_t child = 0; child < arrayLength; child++) {
 
             CParameterBlock *pChildParameterBlock =
-                new CParameterBlock(std::to_string(child), this);
+                new (arena) CParameterBlock(std::to_string(child), this);
 
             pElement->addChild(pChildParameterBlock);
 
-            base::populate(pChildParameterBlock);
+            base::populate(pChildParameterBlock, arena);
         }
     } else {
         // Regular block
-        base::populate(pElement);
+        base::populate(pElement, arena);
     }
 }
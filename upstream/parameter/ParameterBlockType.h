@@ -44,7 +44,7 @@ public:
 private:
     virtual bool childrenAreDynamic() const;
     // Instantiation
-    virtual CInstanceConfigurableElement *doInstantiate() const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
     // Population
-    virtual void populate(CElement *pElement) const;
+    virtual void populate(CElement *pElement, utility::Arena &arena) const;
 };
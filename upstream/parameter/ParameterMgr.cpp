@@ -34,27 +34,18 @@
 #include "XmlElementSerializingContext.h"
 #include "SystemClass.h"
 #include "ElementLibrarySet.h"
+#include "ParameterMgrModel.h"
 #include "SubsystemLibrary.h"
-#include "NamedElementBuilderTemplate.h"
-#include "KindElementBuilderTemplate.h"
-#include "ElementBuilderTemplate.h"
 #include "SelectionCriterionType.h"
 #include "SubsystemElementBuilder.h"
 #include "FileIncluderElementBuilder.h"
 #include "SelectionCriteria.h"
-#include "ComponentType.h"
-#include "ComponentInstance.h"
-#include "ParameterBlockType.h"
-#include "BooleanParameterType.h"
-#include "IntegerParameterType.h"
-#include "FixedPointParameterType.h"
-#include "FloatingPointParameterType.h"
 #include "ParameterBlackboard.h"
+#include "BlackboardComparator.h"
 #include "Parameter.h"
 #include "ParameterAccessContext.h"
 #include "ParameterFrameworkConfiguration.h"
 #include "FrameworkConfigurationGroup.h"
-#include "PluginLocation.h"
 #include "SubsystemPlugins.h"
 #include "FrameworkConfigurationLocation.h"
 #include "ConfigurableDomains.h"
@@ -63,34 +54,34 @@
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainExportContext.h"
 #include "XmlDomainImportContext.h"
-#include "BitParameterBlockType.h"
-#include "BitParameterType.h"
-#include "StringParameterType.h"
-#include "EnumParameterType.h"
 #include "BackgroundRemoteProcessorServer.h"
 #include "ElementLocator.h"
-#include "CompoundRule.h"
-#include "SelectionCriterionRule.h"
 #include "SimulatedBackSynchronizer.h"
 #include "HardwareBackSynchronizer.h"
 #include <cassert>
 #include "ParameterHandle.h"
-#include "LinearParameterAdaptation.h"
-#include "LogarithmicParameterAdaptation.h"
-#include "EnumValuePair.h"
 #include "Subsystem.h"
 #include "XmlStreamDocSink.h"
 #include "XmlMemoryDocSink.h"
 #include "XmlDocSource.h"
+#include "XmlReaderDocSource.h"
+#include "XmlDocPrefetcher.h"
 #include "XmlMemoryDocSource.h"
 #include "SelectionCriteriaDefinition.h"
+#include "SettingsImage.h"
+#include "StructureImage.h"
+#include "RuntimeCheckpoint.h"
+#include "ImageFile.h"
 #include "Utility.h"
 #include "Memory.hpp"
 #include <sstream>
 #include <fstream>
 #include <algorithm>
+#include <chrono>
 #include <stdexcept>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <iomanip>
 #include "convert.hpp"
 
@@ -154,6 +145,8 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
 
     /// Status
     {"status", &CParameterMgr::statusCommandProcess, 0, "", "Show current status"},
+    {"showStartupProfile", &CParameterMgr::showStartupProfileCommandProcess, 0, "",
+     "Show time and memory spent by each start phase"},
 
     /// Tuning Mode
     {"setTuningMode", &CParameterMgr::setTuningModeCommandProcess, 1, "on|off*",
@@ -231,12 +224,25 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
      "Clear configuration application rule"},
     {"getRule", &CParameterMgr::getRuleCommandProcess, 2, "<domain> <configuration>",
      "Get configuration application rule"},
+    {"diffConfigurations", &CParameterMgr::diffConfigurationsCommandProcess, 3,
+     "<domain> <configuration> <configuration>",
+     "List parameters whose settings differ between configurations"},
+    {"showSettingsMemory", &CParameterMgr::showSettingsMemoryCommandProcess, 0, "",
+     "Show memory used by configuration settings"},
+    {"setSettingsCompression", &CParameterMgr::setSettingsCompressionCommandProcess, 1,
+     "<idle delay ms>|off*", "Compress settings of configurations not applied for given delay"},
+    {"getSettingsCompression", &CParameterMgr::getSettingsCompressionCommandProcess, 0, "",
+     "Show settings compression idle delay"},
 
     /// Elements/Parameters
     {"listElements", &CParameterMgr::listElementsCommandProcess, 1, "<elem path>|/",
      "List elements under element at given path or root"},
     {"listParameters", &CParameterMgr::listParametersCommandProcess, 1, "<elem path>|/",
      "List parameters under element at given path or root"},
+    {"getEpoch", &CParameterMgr::getEpochCommandProcess, 0, "",
+     "Show parameter modification epoch"},
+    {"getChangedSince", &CParameterMgr::getChangedSinceCommandProcess, 1, "<epoch>",
+     "List parameters modified after given epoch"},
     {"getElementStructureXML", &CParameterMgr::getElementStructureXMLCommandProcess, 1,
      "<elem path>", "Get structure of element at given path in XML format"},
     {"getElementBytes", &CParameterMgr::getElementBytesCommandProcess, 1, "<elem path>",
@@ -302,6 +308,11 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
      "Import a single domain including settings from XML file."
      " Does not overwrite an existing domain unless 'overwrite' is passed as second"
      " argument. Provide an absolute path or relative to the client's working directory)"},
+    {"exportSettingsImage", &CParameterMgr::exportSettingsImageCommandProcess, 1, "<file path>",
+     "Export domains including settings to a binary settings image (provide an absolute path"
+     " or relative to the client's working directory)"},
+    {"reloadSettings", &CParameterMgr::reloadSettingsCommandProcess, 0, "",
+     "Read the settings again from the configuration files and apply what changed"},
     {"getDomainsWithSettingsXML", &CParameterMgr::getDomainsWithSettingsXMLCommandProcess, 0, "",
      "Print domains including settings as XML"},
     {"getDomainWithSettingsXML", &CParameterMgr::getDomainWithSettingsXMLCommandProcess, 1,
@@ -323,8 +334,9 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
 };
 
 // Remote command parsers array Size
-CParameterMgr::CParameterMgr(const string &strConfigurationFilePath, log::ILogger &logger)
-    : _pMainParameterBlackboard(new CParameterBlackboard),
+CParameterMgr::CParameterMgr(const string &strConfigurationFilePath,
+                             std::shared_ptr<CParameterMgrModel> model, log::ILogger &logger)
+    : _pMainParameterBlackboard(new CParameterBlackboard), _model(model),
       _pElementLibrarySet(new CElementLibrarySet),
       _xmlConfigurationUri(CXmlDocSource::mkUri(strConfigurationFilePath, "")), _logger(logger)
 {
@@ -333,10 +345,25 @@ CParameterMgr::CParameterMgr(const string &strConfigurationFilePath, log::ILogge
     addChild(new CSelectionCriteria);
     addChild(new CSystemClass(_logger));
     addChild(new CConfigurableDomains);
+
+    // Allow clients to poll parameter modifications
+    _pMainParameterBlackboard->trackModifications();
 }
 
 CParameterMgr::~CParameterMgr()
 {
+    stopSettingsWarmUp();
+
+    // Runtime checkpoint writer
+    if (_checkpointWriter.valid()) {
+        {
+            lock_guard<mutex> stopLock(_checkpointWriterMutex);
+            _bStopCheckpointWriter = true;
+        }
+        _checkpointWriterStop.notify_one();
+        _checkpointWriter.wait();
+    }
+
     // Children
     delete _pRemoteProcessorServer;
     delete _pMainParameterBlackboard;
@@ -358,49 +385,85 @@ bool CParameterMgr::load(string &strError)
 {
     LOG_CONTEXT("Loading");
 
-    feedElementLibraries();
+    // Each phase is profiled
+    _startupProfile.clear();
+    using Phase = CStartupProfile::CScope;
+
+    {
+        Phase phase(&_startupProfile, "Element libraries");
+        feedElementLibraries();
+    }
 
     // Load Framework configuration
-    if (!loadFrameworkConfiguration(strError)) {
+    {
+        Phase phase(&_startupProfile, "Framework configuration");
+        if (!loadFrameworkConfiguration(strError)) {
 
-        return false;
+            return false;
+        }
     }
 
-    if (!loadSubsystems(strError)) {
+    {
+        Phase phase(&_startupProfile, "Plugins");
+        if (!loadSubsystems(strError)) {
 
-        return false;
+            return false;
+        }
     }
 
     // Load structure
-    if (!loadStructure(strError)) {
+    {
+        Phase phase(&_startupProfile, "Structure");
+        if (!loadStructure(strError)) {
 
-        return false;
+            return false;
+        }
     }
 
     // Load settings
-    if (!loadSettings(strError)) {
+    {
+        Phase phase(&_startupProfile, "Settings");
+        if (!loadSettings(strError)) {
 
-        return false;
+            return false;
+        }
     }
 
     // Init flow of element tree
-    if (!init(strError)) {
+    {
+        Phase phase(&_startupProfile, "Init");
+        if (!init(strError)) {
 
-        return false;
+            return false;
+        }
     }
 
-    {
+    // The hardware still holds the runtime state checkpointed by a previous run
+    bool bCheckpointRestored = false;
+
+    if (!_checkpointPath.empty()) {
+
+        Phase phase(&_startupProfile, "Runtime checkpoint");
+        bCheckpointRestored = restoreRuntimeCheckpoint();
+    }
+
+    if (!bCheckpointRestored) {
+
+        Phase phase(&_startupProfile, "Back synchronization");
         LOG_CONTEXT("Main blackboard back synchronization");
 
         // Back synchronization for areas in parameter blackboard not covered by any domain
-        BackSynchronizer(getConstSystemClass(), _pMainParameterBlackboard).sync();
+        backSynchronize();
     }
 
     // We're done loading the settings and back synchronizing
     CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
 
     // We need to ensure all domains are valid
-    pConfigurableDomains->validate(_pMainParameterBlackboard);
+    {
+        Phase phase(&_startupProfile, "Domain validation");
+        pConfigurableDomains->validate(_pMainParameterBlackboard);
+    }
 
     // Log selection criterion states
     {
@@ -418,7 +481,29 @@ bool CParameterMgr::load(string &strError)
     getSystemClass()->cleanSubsystemsNeedToResync();
 
     // At initialization, check subsystems that need resync
-    doApplyConfigurations(true);
+    // After a checkpoint restoration, only the configurations that changed are applied
+    {
+        Phase phase(&_startupProfile, "Initial application");
+        doApplyConfigurations(!bCheckpointRestored);
+    }
+
+    if (_bLogStartupProfile) {
+
+        info() << "Startup profile:\n" << _startupProfile.toString();
+    }
+
+    // Copy in the background the settings that have not been used yet
+    if (_bLazySettingsLoading && _bSettingsWarmUp) {
+
+        _settingsWarmUp = std::async(std::launch::async, &CParameterMgr::warmUpSettings, this);
+    }
+
+    // Write the runtime checkpoint in the background
+    if (_bCheckpointEnabled && _checkpointPeriodMs != 0) {
+
+        _checkpointWriter = std::async(std::launch::async,
+                                       &CParameterMgr::writeRuntimeCheckpointPeriodically, this);
+    }
 
     // Start remote processor server if appropriate
     return handleRemoteProcessingInterface(strError);
@@ -508,18 +593,64 @@ bool CParameterMgr::loadStructure(string &strError)
     // Parse Structure XML file
     CParameterAccessContext accessContext(strError);
     CXmlParameterSerializingContext parameterBuildContext(accessContext, strError);
+    parameterBuildContext.setStartupProfile(&_startupProfile);
+    parameterBuildContext.setDeferredMapping(true);
+    parameterBuildContext.setInstanceArena(&pSystemClass->getInstanceArena());
+    parameterBuildContext.setModel(_model.get());
 
-    {
-        // Get structure URI
-        string structureUri =
-            CXmlDocSource::mkUri(_xmlConfigurationUri, pStructureDescriptionFileLocation->getUri());
+    // Get structure URI
+    string structureUri =
+        CXmlDocSource::mkUri(_xmlConfigurationUri, pStructureDescriptionFileLocation->getUri());
+
+    // Precompiled structure image, used instead of the XML files when up to date
+    const CFrameworkConfigurationLocation *pStructureImageFileLocation =
+        static_cast<const CFrameworkConfigurationLocation *>(
+            getConstFrameworkConfiguration()->findChildOfKind("StructureImageFileLocation"));
+
+    string structureImageUri;
+    bool bFromImage = false;
+
+    if (pStructureImageFileLocation) {
+
+        structureImageUri =
+            CXmlDocSource::mkUri(_xmlConfigurationUri, pStructureImageFileLocation->getUri());
+
+        LOG_CONTEXT("Importing system structure from structure image " + structureImageUri);
+
+        string strImageError;
+        bFromImage = CStructureImage::load(
+            structureImageUri, structureUri, *pSystemClass, *_model, &_startupProfile,
+            _structureHash, strImageError);
+
+        if (!bFromImage) {
+
+            info() << "Structure image " << structureImageUri << " not used: " << strImageError;
+            pSystemClass->clean();
+        }
+    }
+
+    // Files the structure is read from, recorded to stamp the structure image
+    std::vector<string> sourceUris;
+    if (!structureImageUri.empty() && !bFromImage) {
+
+        parameterBuildContext.setSourceUris(&sourceUris);
+    }
+
+    if (!bFromImage) {
 
         LOG_CONTEXT("Importing system structure from file " + structureUri);
 
+        // Included subsystem files are read concurrently while the structure is being built
+        CXmlDocPrefetcher docPrefetcher;
+
         _xmlDoc *doc = CXmlDocSource::mkXmlDoc(structureUri, true, true, parameterBuildContext);
         if (doc == NULL) {
             return false;
         }
+        parameterBuildContext.recordSource(structureUri, doc);
+        docPrefetcher.prefetchIncludes(doc, "SubsystemInclude", structureUri,
+                                       _bValidateSchemasOnStart, getSchemaUri());
+        parameterBuildContext.setDocPrefetcher(&docPrefetcher);
 
         if (!xmlParse(parameterBuildContext, pSystemClass, doc, structureUri,
                       EParameterCreationLibrary)) {
@@ -528,9 +659,37 @@ bool CParameterMgr::loadStructure(string &strError)
         }
     }
 
+    {
+        // Subsystems have independent trees, map them concurrently
+        CStartupProfile::CScope profileScope(&_startupProfile, "Subsystem mapping");
+
+        if (!pSystemClass->mapSubsystems(_mappingConcurrency, &_startupProfile, strError)) {
+
+            return false;
+        }
+    }
+
     // Initialize offsets
     pSystemClass->setOffset(0);
 
+    if (!bFromImage) {
+
+        // Walks the whole structure, the images and checkpoints reuse it
+        _structureHash = CSettingsImage::hashStructure(*pSystemClass);
+    }
+
+    // Build the structure image for the next starts
+    if (!structureImageUri.empty() && !bFromImage) {
+
+        string strImageError;
+
+        if (!CStructureImage::save(structureImageUri, sourceUris, *pSystemClass, _structureHash,
+                                   strImageError)) {
+
+            warning() << "Failed to write structure image: " << strImageError;
+        }
+    }
+
     // Initialize main blackboard's size
     _pMainParameterBlackboard->setSize(pSystemClass->getFootPrint());
 
@@ -540,7 +699,7 @@ bool CParameterMgr::loadStructure(string &strError)
 bool CParameterMgr::loadSettings(string &strError)
 {
     string strLoadError;
-    bool success = loadSettingsFromConfigFile(strLoadError);
+    bool success = loadSettingsFromConfigFile(*getConfigurableDomains(), strLoadError);
 
     if (!success && !_bFailOnFailedSettingsLoad) {
         // Load can not fail, ie continue but log the load errors
@@ -558,7 +717,8 @@ bool CParameterMgr::loadSettings(string &strError)
     return true;
 }
 
-bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
+bool CParameterMgr::loadSettingsFromConfigFile(CConfigurableDomains &configurableDomains,
+                                               string &strError)
 {
     LOG_CONTEXT("Loading settings");
 
@@ -586,8 +746,8 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
 
         return false;
     }
-    // Get destination root element
-    CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
+    // Destination root element
+    CConfigurableDomains *pConfigurableDomains = &configurableDomains;
 
     // Get Xml configuration domains URI
     string configurationDomainsUri =
@@ -603,17 +763,80 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
     // Auto validation of configurations
     xmlDomainImportContext.setAutoValidationRequired(true);
 
+    // Precompiled settings image, used instead of the XML file when up to date
+    string settingsImageUri = getSettingsFileUri("SettingsImageFileLocation");
+
+    if (!settingsImageUri.empty()) {
+
+        string strImageError;
+
+        if (CSettingsImage::load(settingsImageUri, configurationDomainsUri, *getSystemClass(),
+                                 _structureHash,
+                                 getConstSelectionCriteria()->getSelectionCriteriaDefinition(),
+                                 *pConfigurableDomains, _bLazySettingsLoading, strImageError)) {
+
+            info() << "Imported configurable domains from settings image " << settingsImageUri;
+            return true;
+        }
+        info() << "Settings image " << settingsImageUri << " not used: " << strImageError;
+
+        pConfigurableDomains->deleteAllDomains();
+    }
+
     info() << "Importing configurable domains from file " << configurationDomainsUri
            << " with settings";
 
-    _xmlDoc *doc =
-        CXmlDocSource::mkXmlDoc(configurationDomainsUri, true, true, xmlDomainImportContext);
-    if (doc == NULL) {
+    // Read one domain at a time: the whole document is never in memory
+    xmlDomainImportContext.set(
+        _pElementLibrarySet->getElementLibrary(EParameterConfigurationLibrary),
+        _xmlConfigurationUri);
+
+    CXmlReaderDocSource docSource(configurationDomainsUri, true, _bValidateSchemasOnStart,
+                                  pConfigurableDomains->getXmlElementName(),
+                                  pConfigurableDomains->getName(), "SystemClassName");
+    docSource.setSchemaBaseUri(getSchemaUri());
+
+    pConfigurableDomains->clean();
+
+    if (!docSource.populate(xmlDomainImportContext) ||
+        !pConfigurableDomains->fromXmlReader(docSource, xmlDomainImportContext)) {
+
+        pConfigurableDomains->clean();
         return false;
     }
 
-    return xmlParse(xmlDomainImportContext, pConfigurableDomains, doc, _xmlConfigurationUri,
-                    EParameterConfigurationLibrary, true, "SystemClassName");
+    // Build the settings image for the next starts
+    if (!settingsImageUri.empty()) {
+
+        string strImageError;
+
+        if (!CSettingsImage::save(settingsImageUri, configurationDomainsUri, _structureHash,
+                                  *pConfigurableDomains, strImageError)) {
+
+            warning() << "Failed to write settings image: " << strImageError;
+        }
+    }
+    return true;
+}
+
+string CParameterMgr::getSettingsFileUri(const string &kind) const
+{
+    const CElement *pParameterConfigurationGroup =
+        getConstFrameworkConfiguration()->findChildOfKind("SettingsConfiguration");
+
+    if (!pParameterConfigurationGroup) {
+
+        return "";
+    }
+    const CFrameworkConfigurationLocation *pFileLocation =
+        static_cast<const CFrameworkConfigurationLocation *>(
+            pParameterConfigurationGroup->findChildOfKind(kind));
+
+    if (!pFileLocation) {
+
+        return "";
+    }
+    return CXmlDocSource::mkUri(_xmlConfigurationUri, pFileLocation->getUri());
 }
 
 // XML parsing
@@ -681,22 +904,134 @@ void CParameterMgr::applyConfigurations()
 {
     LOG_CONTEXT("Configuration application request");
 
-    // Lock state
+    ChangeNotifications notifications;
+    {
+        // Lock state
+        lock_guard<mutex> autoLock(getBlackboardMutex());
+
+        if (!_bTuningModeIsOn) {
+
+            // Apply configuration(s)
+            notifications = doApplyConfigurationsAndListChanges(false);
+        } else {
+
+            warning() << "Configurations were not applied because the TuningMode is on";
+        }
+    }
+    // Notify changes once unlocked, so that subscribers may access parameters
+    notifyChanges(notifications);
+}
+
+// Settings reloading
+bool CParameterMgr::reloadSettings(string &changes, string &strError)
+{
+    LOG_CONTEXT("Reloading settings");
+
+    if (!getConstFrameworkConfiguration()->findChildOfKind("SettingsConfiguration")) {
+
+        strError = "No settings configuration to reload the settings from";
+        return false;
+    }
+    ChangeNotifications notifications;
+    {
+        // Lock state
+        lock_guard<mutex> autoLock(getBlackboardMutex());
+
+        // Read the settings aside, the current ones are kept on failure
+        CConfigurableDomains reloadedDomains;
+
+        if (!loadSettingsFromConfigFile(reloadedDomains, strError)) {
+
+            return false;
+        }
+        CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
+        core::Results infos;
+
+        pConfigurableDomains->updateFrom(reloadedDomains, infos);
+        ++_domainsRevision;
+
+        // Added and replaced domains may lack settings for some elements
+        pConfigurableDomains->validate(_pMainParameterBlackboard);
+
+        info() << infos;
+        changes = utility::asString(infos);
+
+        // The checkpoints are now tagged with the new domains file
+        if (_bCheckpointEnabled &&
+            !CRuntimeCheckpoint::computeTag(_structureHash,
+                                            getSettingsFileUri("ConfigurableDomainsFileLocation"),
+                                            _checkpointTag, strError)) {
+
+            warning() << "Runtime checkpoint disabled: " << strError;
+            _bCheckpointEnabled = false;
+        }
+
+        if (!_bTuningModeIsOn) {
+
+            notifications = doApplyConfigurationsAndListChanges(false);
+        } else {
+
+            warning() << "Configurations were not applied because the TuningMode is on";
+        }
+    }
+    notifyChanges(notifications);
+
+    return true;
+}
+
+// Parameter change subscriptions
+ElementHandle::SubscriptionId CParameterMgr::subscribeToChanges(
+    const CConfigurableElement &element, ElementHandle::ChangeCallback callback)
+{
+    lock_guard<mutex> autoLock(_changeSubscriptionsMutex);
+
+    ElementHandle::SubscriptionId subscriptionId = ++_lastChangeSubscriptionId;
+    _changeSubscriptions[subscriptionId] = {&element, std::move(callback)};
+
+    return subscriptionId;
+}
+
+void CParameterMgr::unsubscribeFromChanges(ElementHandle::SubscriptionId subscriptionId)
+{
+    lock_guard<mutex> autoLock(_changeSubscriptionsMutex);
+
+    _changeSubscriptions.erase(subscriptionId);
+}
+
+// Parameter modification epochs
+uint64_t CParameterMgr::getEpoch()
+{
     lock_guard<mutex> autoLock(getBlackboardMutex());
 
-    if (!_bTuningModeIsOn) {
+    return _pMainParameterBlackboard->getEpoch();
+}
 
-        // Apply configuration(s)
-        doApplyConfigurations(false);
-    } else {
+std::vector<string> CParameterMgr::getChangedSince(uint64_t epoch)
+{
+    lock_guard<mutex> autoLock(getBlackboardMutex());
 
-        warning() << "Configurations were not applied because the TuningMode is on";
+    std::vector<string> paths;
+    auto spans = _pMainParameterBlackboard->getModifiedSince(epoch);
+
+    if (!spans.empty()) {
+
+        CBlackboardComparator::listOverlappingParameters(*getConstSystemClass(), 0, spans, paths);
     }
+    return paths;
 }
 
 const CConfigurableElement *CParameterMgr::getConfigurableElement(const string &strPath,
                                                                   string &strError) const
 {
+    // Elements are indexed by path
+    const CElement *pIndexedElement = getConstSystemClass()->findElement(strPath);
+
+    if (pIndexedElement) {
+
+        return static_cast<const CConfigurableElement *>(pIndexedElement);
+    }
+
+    // Not found, navigate to report why
     CPathNavigator pathNavigator(strPath);
 
     // Nagivate through system class
@@ -781,6 +1116,44 @@ ElementHandle *CParameterMgr::createElementHandle(const std::string &path, std::
     return new ElementHandle(*pConfigurableElement, *this);
 }
 
+template <class T>
+ScalarHandle<T> *CParameterMgr::createScalarHandle(const std::string &path, std::string &error)
+{
+    CConfigurableElement *pConfigurableElement = getConfigurableElement(path, error);
+
+    if (!pConfigurableElement) {
+
+        // Element not found
+        error = "Element not found: " + path;
+        return nullptr;
+    }
+
+    if (!pConfigurableElement->isParameter()) {
+
+        // Element is not parameter
+        error = "Not a parameter: " + path;
+        return nullptr;
+    }
+    std::unique_ptr<ScalarHandle<T>> handle(
+        new ScalarHandle<T>(static_cast<CBaseParameter &>(*pConfigurableElement), *this));
+
+    // Ensure we're safe against concurrent domains reload
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    if (!handle->bind(error)) {
+
+        return nullptr;
+    }
+    return handle.release();
+}
+
+template ScalarHandle<uint32_t> *CParameterMgr::createScalarHandle(const std::string &,
+                                                                   std::string &);
+template ScalarHandle<int32_t> *CParameterMgr::createScalarHandle(const std::string &,
+                                                                  std::string &);
+template ScalarHandle<bool> *CParameterMgr::createScalarHandle(const std::string &,
+                                                               std::string &);
+
 void CParameterMgr::getSettingsAsBytes(const CConfigurableElement &element,
                                        std::vector<uint8_t> &settings) const
 {
@@ -856,6 +1229,82 @@ bool CParameterMgr::getValidateSchemasOnStart() const
     return _bValidateSchemasOnStart;
 }
 
+void CParameterMgr::setSettingsCompression(bool bCompress, uint32_t idleDelayMs)
+{
+    // Read when configurations are applied, possibly from another thread
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    _bSettingsCompression = bCompress;
+    _settingsCompressionDelayMs = idleDelayMs;
+}
+
+bool CParameterMgr::getSettingsCompression(uint32_t &idleDelayMs) const
+{
+    lock_guard<mutex> autoLock(_blackboardMutex);
+
+    idleDelayMs = _settingsCompressionDelayMs;
+    return _bSettingsCompression;
+}
+
+void CParameterMgr::setLazySettingsLoading(bool bLazy, bool bWarmUp)
+{
+    _bLazySettingsLoading = bLazy;
+    _bSettingsWarmUp = bWarmUp;
+}
+
+bool CParameterMgr::getLazySettingsLoading(bool &bWarmUp) const
+{
+    bWarmUp = _bSettingsWarmUp;
+    return _bLazySettingsLoading;
+}
+
+void CParameterMgr::setBackSynchronizationConcurrency(size_t concurrency)
+{
+    _backSyncConcurrency = concurrency;
+}
+
+size_t CParameterMgr::getBackSynchronizationConcurrency() const
+{
+    return _backSyncConcurrency;
+}
+
+void CParameterMgr::setMappingConcurrency(size_t concurrency)
+{
+    _mappingConcurrency = concurrency;
+}
+
+size_t CParameterMgr::getMappingConcurrency() const
+{
+    return _mappingConcurrency;
+}
+
+void CParameterMgr::setRuntimeCheckpoint(const string &path, uint32_t periodMs)
+{
+    _checkpointPath = path;
+    _checkpointPeriodMs = periodMs;
+}
+
+const string &CParameterMgr::getRuntimeCheckpoint(uint32_t &periodMs) const
+{
+    periodMs = _checkpointPeriodMs;
+    return _checkpointPath;
+}
+
+string CParameterMgr::getStartupProfile() const
+{
+    return _startupProfile.toString();
+}
+
+void CParameterMgr::setStartupProfileLogging(bool bLog)
+{
+    _bLogStartupProfile = bLog;
+}
+
+bool CParameterMgr::getStartupProfileLogging() const
+{
+    return _bLogStartupProfile;
+}
+
 /////////////////// Remote command parsers
 /// Version
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::versionCommandProcess(
@@ -924,6 +1373,14 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::statusCommandProces
     return CCommandHandler::ESucceeded;
 }
 
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::showStartupProfileCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = getStartupProfile();
+
+    return CCommandHandler::ESucceeded;
+}
+
 /// Tuning Mode
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setTuningModeCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
@@ -1349,6 +1806,59 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getRuleCommandProce
                : CCommandHandler::EFailed;
 }
 
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::diffConfigurationsCommandProcess(
+    const IRemoteCommand &remoteCommand, string &strResult)
+{
+    // Configuration settings may be compressed by a concurrent application
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    // Delegate to configurable domains
+    return getConstConfigurableDomains()->listDifferingParameters(
+               remoteCommand.getArgument(0), remoteCommand.getArgument(1),
+               remoteCommand.getArgument(2), strResult)
+               ? CCommandHandler::ESucceeded
+               : CCommandHandler::EFailed;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::showSettingsMemoryCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    getConstConfigurableDomains()->showSettingsMemory(strResult);
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setSettingsCompressionCommandProcess(
+    const IRemoteCommand &remoteCommand, string & /*strResult*/)
+{
+    const string &strArgument = remoteCommand.getArgument(0);
+    uint32_t idleDelayMs;
+
+    if (strArgument == "off") {
+
+        setSettingsCompression(false, 0);
+    } else if (convertTo(strArgument, idleDelayMs)) {
+
+        setSettingsCompression(true, idleDelayMs);
+    } else {
+        // Show usage
+        return CCommandHandler::EShowUsage;
+    }
+    return CCommandHandler::EDone;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getSettingsCompressionCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    uint32_t idleDelayMs;
+
+    strResult = getSettingsCompression(idleDelayMs) ? std::to_string(idleDelayMs) + " ms" : "off";
+
+    return CCommandHandler::ESucceeded;
+}
+
 /// Elements/Parameters
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listElementsCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
@@ -1403,6 +1913,31 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listParametersComma
     return CCommandHandler::ESucceeded;
 }
 
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getEpochCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = std::to_string(getEpoch());
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getChangedSinceCommandProcess(
+    const IRemoteCommand &remoteCommand, string &strResult)
+{
+    uint64_t epoch;
+
+    if (!convertTo(remoteCommand.getArgument(0), epoch)) {
+
+        strResult = "Invalid epoch: " + remoteCommand.getArgument(0);
+        return CCommandHandler::EFailed;
+    }
+    for (const auto &path : getChangedSince(epoch)) {
+
+        strResult += path + "\n";
+    }
+    return CCommandHandler::ESucceeded;
+}
+
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementStructureXMLCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
@@ -1888,6 +2423,27 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
                : CCommandHandler::EFailed;
 }
 
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::exportSettingsImageCommandProcess(
+    const IRemoteCommand &remoteCommand, string &strResult)
+{
+    return exportSettingsImage(remoteCommand.getArgument(0), strResult) ? CCommandHandler::EDone
+                                                                        : CCommandHandler::EFailed;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::reloadSettingsCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    string strChanges;
+
+    if (!reloadSettings(strChanges, strResult)) {
+
+        return CCommandHandler::EFailed;
+    }
+    strResult = strChanges.empty() ? "No change" : strChanges;
+
+    return CCommandHandler::ESucceeded;
+}
+
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
     getDomainsWithSettingsXMLCommandProcess(const IRemoteCommand & /*command*/, string &strResult)
 {
@@ -2010,6 +2566,9 @@ bool CParameterMgr::accessConfigurationValue(const string &strDomain,
                                              const string &strConfiguration, const string &strPath,
                                              string &strValue, bool bSet, string &strError)
 {
+    // Lock state, the configuration blackboard may otherwise be compressed while accessed
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
     CElementLocator elementLocator(getSystemClass());
 
     CElement *pLocatedElement = NULL;
@@ -2060,7 +2619,7 @@ bool CParameterMgr::accessConfigurationValue(const string &strDomain,
     }
 
     // Access Value in the Configuration Blackboard
-    if (!accessValue(parameterAccessContext, strPath, strValue, bSet, strError)) {
+    if (!doAccessValue(parameterAccessContext, strPath, strValue, bSet, strError)) {
 
         return false;
     }
@@ -2079,7 +2638,7 @@ bool CParameterMgr::accessConfigurationValue(const string &strDomain,
         }
 
         // Access Value in the Main Blackboard
-        return accessValue(parameterAccessContext, strPath, strValue, bSet, strError);
+        return doAccessValue(parameterAccessContext, strPath, strValue, bSet, strError);
     }
 
     return true;
@@ -2093,6 +2652,25 @@ bool CParameterMgr::accessValue(CParameterAccessContext &parameterAccessContext,
     // Lock state
     lock_guard<mutex> autoLock(getBlackboardMutex());
 
+    return doAccessValue(parameterAccessContext, strPath, strValue, bSet, strError);
+}
+
+bool CParameterMgr::doAccessValue(CParameterAccessContext &parameterAccessContext,
+                                  const string &strPath, string &strValue, bool bSet,
+                                  string &strError)
+{
+    // Parameters are indexed by path, array items and errors need the navigation below
+    const CElement *pIndexedElement = getConstSystemClass()->findElement(strPath);
+
+    if (pIndexedElement &&
+        static_cast<const CConfigurableElement *>(pIndexedElement)->isParameter()) {
+
+        CPathNavigator exhaustedPathNavigator;
+
+        return static_cast<const CConfigurableElement *>(pIndexedElement)
+            ->accessValue(exhaustedPathNavigator, strValue, bSet, parameterAccessContext);
+    }
+
     CPathNavigator pathNavigator(strPath);
 
     // Nagivate through system class
@@ -2122,19 +2700,43 @@ bool CParameterMgr::setTuningMode(bool bOn, string &strError)
 
         return false;
     }
-    // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
-
-    // Warn domains about exiting tuning mode
-    if (!bOn) {
+    // Tuning commands edit the domains without locking, the warm-up must not materialize them
+    if (bOn) {
 
-        // Ensure application of currently selected configurations
-        // Force-apply configurations
-        doApplyConfigurations(true);
+        stopSettingsWarmUp();
     }
+    ChangeNotifications notifications;
+    {
+        // Lock state
+        lock_guard<mutex> autoLock(getBlackboardMutex());
+
+        // Warn domains about exiting tuning mode
+        if (!bOn) {
+
+            // Ensure application of currently selected configurations
+            // Force-apply configurations
+            notifications = doApplyConfigurationsAndListChanges(true);
+
+            // The rogue parameters may have changed while tuning
+            ++_domainsRevision;
+        }
+
+        // Tuned settings may differ from the domains file the checkpoint is tagged with
+        if (bOn && _bCheckpointEnabled) {
+
+            info() << "Runtime checkpoint disabled by the tuning mode";
+            _bCheckpointEnabled = false;
+            string strError;
+            if (!CImageFile::remove(_checkpointPath, strError)) {
+
+                warning() << "Runtime checkpoint left in place: " << strError;
+            }
+        }
 
-    // Store
-    _bTuningModeIsOn = bOn;
+        // Store
+        _bTuningModeIsOn = bOn;
+    }
+    notifyChanges(notifications);
 
     return true;
 }
@@ -2639,17 +3241,34 @@ bool CParameterMgr::exportDomainsXml(string &xmlDest, bool withSettings, bool to
     LOG_CONTEXT("Exporting domains to " +
                 (toFile ? ('"' + xmlDest + '"') : "a user-provided buffer"));
 
+    // Configuration settings may be compressed by a concurrent application
+    lock_guard<mutex> autoLock(_blackboardMutex);
+
     const CConfigurableDomains *configurableDomains = getConstConfigurableDomains();
 
     return wrapLegacyXmlExport(xmlDest, toFile, withSettings, *configurableDomains, errorMsg);
 }
 
+bool CParameterMgr::exportSettingsImage(const string &imagePath, string &errorMsg) const
+{
+    LOG_CONTEXT("Exporting settings image to \"" + imagePath + '"');
+
+    // Settings may be materialized by the warm-up or compressed by a concurrent application
+    lock_guard<mutex> autoLock(_blackboardMutex);
+
+    // Tie the image to the domains file the next starts will load
+    return CSettingsImage::save(imagePath, getSettingsFileUri("ConfigurableDomainsFileLocation"),
+                                _structureHash, *getConstConfigurableDomains(), errorMsg);
+}
+
 bool CParameterMgr::exportSingleDomainXml(string &xmlDest, const string &domainName,
                                           bool withSettings, bool toFile, string &errorMsg) const
 {
     LOG_CONTEXT("Exporting single domain '" + domainName + "' to " +
                 (toFile ? ('"' + xmlDest + '"') : "a user-provided buffer"));
 
+    lock_guard<mutex> autoLock(_blackboardMutex);
+
     // Element to be serialized
     const CConfigurableDomain *requestedDomain =
         getConstConfigurableDomains()->findConfigurableDomain(domainName, errorMsg);
@@ -2738,78 +3357,22 @@ CParameterBlackboard *CParameterMgr::getParameterBlackboard()
 void CParameterMgr::feedElementLibraries()
 {
     // Global Configuration handling
-    CElementLibrary *pFrameworkConfigurationLibrary = new CElementLibrary;
-
-    pFrameworkConfigurationLibrary->addElementBuilder(
-        "ParameterFrameworkConfiguration",
-        new TElementBuilderTemplate<CParameterFrameworkConfiguration>());
-    pFrameworkConfigurationLibrary->addElementBuilder(
-        "SubsystemPlugins", new TKindElementBuilderTemplate<CSubsystemPlugins>());
-    pFrameworkConfigurationLibrary->addElementBuilder(
-        "Location", new TKindElementBuilderTemplate<CPluginLocation>());
-    pFrameworkConfigurationLibrary->addElementBuilder(
-        "StructureDescriptionFileLocation",
-        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
-    pFrameworkConfigurationLibrary->addElementBuilder(
-        "SettingsConfiguration", new TKindElementBuilderTemplate<CFrameworkConfigurationGroup>());
-    pFrameworkConfigurationLibrary->addElementBuilder(
-        "ConfigurableDomainsFileLocation",
-        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
-
-    _pElementLibrarySet->addElementLibrary(pFrameworkConfigurationLibrary);
-
-    // Parameter creation
-    CElementLibrary *pParameterCreationLibrary = new CElementLibrary;
+    _pElementLibrarySet->addElementLibrary(_model->getFrameworkConfigurationLibrary());
+
+    // Parameter creation, types being shared with the frameworks of the model
+    auto pParameterCreationLibrary = std::make_shared<CElementLibrary>();
 
     pParameterCreationLibrary->addElementBuilder(
         "Subsystem", new CSubsystemElementBuilder(getSystemClass()->getSubsystemLibrary()));
-    pParameterCreationLibrary->addElementBuilder(
-        "ComponentType", new TNamedElementBuilderTemplate<CComponentType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "Component", new TNamedElementBuilderTemplate<CComponentInstance>());
-    pParameterCreationLibrary->addElementBuilder(
-        "BitParameter", new TNamedElementBuilderTemplate<CBitParameterType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "BitParameterBlock", new TNamedElementBuilderTemplate<CBitParameterBlockType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "StringParameter", new TNamedElementBuilderTemplate<CStringParameterType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "ParameterBlock", new TNamedElementBuilderTemplate<CParameterBlockType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "BooleanParameter", new TNamedElementBuilderTemplate<CBooleanParameterType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "IntegerParameter", new TNamedElementBuilderTemplate<CIntegerParameterType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "LinearAdaptation", new TElementBuilderTemplate<CLinearParameterAdaptation>());
-    pParameterCreationLibrary->addElementBuilder(
-        "LogarithmicAdaptation", new TElementBuilderTemplate<CLogarithmicParameterAdaptation>());
-    pParameterCreationLibrary->addElementBuilder(
-        "EnumParameter", new TNamedElementBuilderTemplate<CEnumParameterType>());
-    pParameterCreationLibrary->addElementBuilder("ValuePair",
-                                                 new TElementBuilderTemplate<CEnumValuePair>());
-    pParameterCreationLibrary->addElementBuilder(
-        "FixedPointParameter", new TNamedElementBuilderTemplate<CFixedPointParameterType>());
-    pParameterCreationLibrary->addElementBuilder(
-        "FloatingPointParameter", new TNamedElementBuilderTemplate<CFloatingPointParameterType>);
     pParameterCreationLibrary->addElementBuilder(
         "SubsystemInclude",
         new CFileIncluderElementBuilder(_bValidateSchemasOnStart, getSchemaUri()));
+    pParameterCreationLibrary->setFallback(_model->getTypeLibrary());
 
     _pElementLibrarySet->addElementLibrary(pParameterCreationLibrary);
 
     // Parameter Configuration Domains creation
-    CElementLibrary *pParameterConfigurationLibrary = new CElementLibrary;
-
-    pParameterConfigurationLibrary->addElementBuilder(
-        "ConfigurableDomain", new TElementBuilderTemplate<CConfigurableDomain>());
-    pParameterConfigurationLibrary->addElementBuilder(
-        "Configuration", new TNamedElementBuilderTemplate<CDomainConfiguration>());
-    pParameterConfigurationLibrary->addElementBuilder("CompoundRule",
-                                                      new TElementBuilderTemplate<CCompoundRule>());
-    pParameterConfigurationLibrary->addElementBuilder(
-        "SelectionCriterionRule", new TElementBuilderTemplate<CSelectionCriterionRule>());
-
-    _pElementLibrarySet->addElementLibrary(pParameterConfigurationLibrary);
+    _pElementLibrarySet->addElementLibrary(_model->getConfigurationLibrary());
 }
 
 bool CParameterMgr::getForceNoRemoteInterface() const
@@ -2884,9 +3447,10 @@ CParameterFrameworkConfiguration *CParameterMgr::getFrameworkConfiguration()
     return static_cast<CParameterFrameworkConfiguration *>(getChild(EFrameworkConfiguration));
 }
 
-const CParameterFrameworkConfiguration *CParameterMgr::getConstFrameworkConfiguration()
+const CParameterFrameworkConfiguration *CParameterMgr::getConstFrameworkConfiguration() const
 {
-    return getFrameworkConfiguration();
+    return static_cast<const CParameterFrameworkConfiguration *>(
+        getChild(EFrameworkConfiguration));
 }
 
 CSelectionCriteria *CParameterMgr::getSelectionCriteria()
@@ -2940,9 +3504,186 @@ void CParameterMgr::doApplyConfigurations(bool bForce)
     getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce, infos);
     info() << infos;
 
+    // Compress the settings of configurations that have not been applied for a while
+    if (_bSettingsCompression) {
+
+        getConfigurableDomains()->compressIdleConfigurations(
+            std::chrono::milliseconds(_settingsCompressionDelayMs));
+    }
+
     // Reset the modified status of the current criteria to indicate that a new configuration has
     // been applied
     getSelectionCriteria()->resetModifiedStatus();
+
+    // Unless written periodically
+    if (_checkpointPeriodMs == 0) {
+
+        writeRuntimeCheckpoint();
+    }
+}
+
+// Start back synchronization
+void CParameterMgr::backSynchronize()
+{
+    const CSystemClass *pSystemClass = getConstSystemClass();
+
+    if (_backSyncConcurrency <= 1) {
+
+        BackSynchronizer(pSystemClass, _pMainParameterBlackboard).sync();
+        return;
+    }
+
+    // Subsystems write to disjoint areas of the blackboard
+    _pMainParameterBlackboard->suspendModificationTracking();
+
+    getSystemClass()->forEachSubsystem(_backSyncConcurrency, [this](size_t, CSubsystem &subsystem) {
+        BackSynchronizer(&subsystem, _pMainParameterBlackboard).sync();
+    });
+
+    _pMainParameterBlackboard->resumeModificationTracking();
+}
+
+// Lazy settings warm-up
+void CParameterMgr::warmUpSettings()
+{
+    for (size_t domain = 0; !_bStopSettingsWarmUp; domain++) {
+
+        lock_guard<mutex> autoLock(getBlackboardMutex());
+
+        const CConfigurableDomains *pConfigurableDomains = getConstConfigurableDomains();
+
+        if (domain >= pConfigurableDomains->getNbChildren()) {
+
+            return;
+        }
+        static_cast<const CConfigurableDomain *>(pConfigurableDomains->getChild(domain))
+            ->materializeConfigurations();
+    }
+}
+
+void CParameterMgr::stopSettingsWarmUp()
+{
+    if (_settingsWarmUp.valid()) {
+
+        _bStopSettingsWarmUp = true;
+        _settingsWarmUp.wait();
+    }
+}
+
+// Runtime checkpoint
+bool CParameterMgr::restoreRuntimeCheckpoint()
+{
+    LOG_CONTEXT("Runtime checkpoint restoration");
+
+    string strError;
+
+    if (!CRuntimeCheckpoint::computeTag(_structureHash,
+                                        getSettingsFileUri("ConfigurableDomainsFileLocation"),
+                                        _checkpointTag, strError)) {
+
+        warning() << "Runtime checkpoint disabled: " << strError;
+        return false;
+    }
+    _bCheckpointEnabled = true;
+
+    std::vector<uint8_t> content;
+
+    if (!CImageFile::read(_checkpointPath, content, strError) ||
+        !CRuntimeCheckpoint::restore(content, _checkpointTag, *_pMainParameterBlackboard,
+                                     *getConfigurableDomains(), *getSelectionCriteria(),
+                                     strError)) {
+
+        info() << "Runtime checkpoint " << _checkpointPath << " not used: " << strError;
+        return false;
+    }
+    info() << "Restored runtime checkpoint " << _checkpointPath;
+
+    _lastCheckpoint = std::move(content);
+    return true;
+}
+
+void CParameterMgr::writeRuntimeCheckpoint()
+{
+    if (!_bCheckpointEnabled) {
+
+        return;
+    }
+    std::vector<uint8_t> checkpoint = CRuntimeCheckpoint::capture(
+        _checkpointTag, *_pMainParameterBlackboard, *getConstConfigurableDomains(),
+        *getConstSelectionCriteria());
+
+    if (checkpoint == _lastCheckpoint) {
+
+        return;
+    }
+    string strError;
+
+    if (!CImageFile::write(_checkpointPath, checkpoint, strError)) {
+
+        warning() << "Failed to write runtime checkpoint: " << strError;
+        return;
+    }
+    _lastCheckpoint = std::move(checkpoint);
+}
+
+void CParameterMgr::writeRuntimeCheckpointPeriodically()
+{
+    std::unique_lock<mutex> stopLock(_checkpointWriterMutex);
+
+    while (!_checkpointWriterStop.wait_for(stopLock,
+                                           std::chrono::milliseconds(_checkpointPeriodMs),
+                                           [this] { return _bStopCheckpointWriter; })) {
+
+        lock_guard<mutex> autoLock(getBlackboardMutex());
+        writeRuntimeCheckpoint();
+    }
+}
+
+CParameterMgr::ChangeNotifications CParameterMgr::doApplyConfigurationsAndListChanges(bool bForce)
+{
+    std::vector<SChangeSubscription> subscriptions;
+    {
+        lock_guard<mutex> autoLock(_changeSubscriptionsMutex);
+
+        for (const auto &subscription : _changeSubscriptions) {
+
+            subscriptions.push_back(subscription.second);
+        }
+    }
+    if (subscriptions.empty()) {
+
+        doApplyConfigurations(bForce);
+        return {};
+    }
+    // Keep the values before application to find the changed parameters
+    CParameterBlackboard previousBlackboard;
+    previousBlackboard.setSize(_pMainParameterBlackboard->getSize());
+    _pMainParameterBlackboard->saveTo(&previousBlackboard, 0);
+
+    doApplyConfigurations(bForce);
+
+    ChangeNotifications notifications;
+    CBlackboardComparator comparator(*_pMainParameterBlackboard, previousBlackboard, 0);
+
+    for (const auto &subscription : subscriptions) {
+
+        std::vector<string> changedParameters;
+        comparator.listDifferingParameters(*subscription.element, changedParameters);
+
+        if (!changedParameters.empty()) {
+
+            notifications.push_back({subscription.callback, std::move(changedParameters)});
+        }
+    }
+    return notifications;
+}
+
+void CParameterMgr::notifyChanges(const ChangeNotifications &notifications)
+{
+    for (const auto &notification : notifications) {
+
+        notification.callback(notification.changedParameters);
+    }
 }
 
 // Export to XML string
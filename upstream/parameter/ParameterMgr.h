@@ -29,7 +29,11 @@
  */
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <future>
 #include <mutex>
+#include <thread>
 #include <map>
 #include <vector>
 #include "RemoteCommandHandlerTemplate.h"
@@ -42,6 +46,8 @@
 #include "XmlDomainExportContext.h"
 #include "Results.h"
 #include "ElementHandle.h"
+#include "ScalarHandle.h"
+#include "StartupProfile.h"
 #include <log/LogWrapper.h>
 #include <log/Context.h>
 
@@ -51,6 +57,7 @@
 #include <string>
 
 class CElementLibrarySet;
+class CParameterMgrModel;
 class CSubsystemLibrary;
 class CSystemClass;
 class CSelectionCriteria;
@@ -81,10 +88,19 @@ class CParameterMgr : private CElement
 
     // Parameter handle friendship
     friend class ElementHandle;
+    template <class T>
+    friend class ScalarHandle;
+    friend class ParameterBatch;
 
 public:
-    // Construction
-    CParameterMgr(const std::string &strConfigurationFilePath, core::log::ILogger &logger);
+    /** Construction
+     *
+     * @param[in] strConfigurationFilePath the top level configuration file
+     * @param[in] model the immutable parts shared with the frameworks of the same model
+     * @param[in] logger the logger of the framework
+     */
+    CParameterMgr(const std::string &strConfigurationFilePath,
+                  std::shared_ptr<CParameterMgrModel> model, core::log::ILogger &logger);
     virtual ~CParameterMgr();
 
     /** Load plugins, structures and settings from the config file given.
@@ -115,6 +131,17 @@ public:
     // Configuration application
     void applyConfigurations();
 
+    /** Read the settings again from the configuration files and apply what changed
+     *
+     * Only the domains whose selected configuration or settings changed are applied again,
+     * see CConfigurableDomains::updateFrom. Nothing is applied while the tuning mode is on.
+     *
+     * @param[out] changes what changed in the domains, one line per change
+     * @param[out] strError human readable error, the current settings being kept on failure
+     * @return true on success, false otherwise
+     */
+    bool reloadSettings(std::string &changes, std::string &strError);
+
     /** const version of getConfigurableElement */
     const CConfigurableElement *getConfigurableElement(const std::string &strPath,
                                                        std::string &strError) const;
@@ -144,6 +171,41 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error);
 
+    /** Creates a value typed handle to a scalar parameter.
+     *
+     * The returned object is owned by the client who is responsible to delete it.
+     *
+     * @param[in] path the path of the parameter.
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return a scalar handle on success
+     *         nullptr on error
+     */
+    template <class T>
+    ScalarHandle<T> *createScalarHandle(const std::string &path, std::string &error);
+
+    /** Subscribe to the changes of the parameters under an element.
+     *
+     * @see ElementHandle::subscribeToChanges
+     */
+    ElementHandle::SubscriptionId subscribeToChanges(const CConfigurableElement &element,
+                                                     ElementHandle::ChangeCallback callback);
+    void unsubscribeFromChanges(ElementHandle::SubscriptionId subscriptionId);
+
+    /** @return the parameter modification epoch, incremented by each parameter modification */
+    uint64_t getEpoch();
+
+    /** List the parameters modified after an epoch.
+     *
+     * Modifications are tracked by blocks of bytes: a parameter sharing a block with a modified
+     * one may be listed as well.
+     *
+     * @param[in] epoch the epoch, as returned by getEpoch, after which modifications are listed
+     * @return the paths of the modified parameters
+     */
+    std::vector<std::string> getChangedSince(uint64_t epoch);
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -210,6 +272,104 @@ public:
      */
     bool getValidateSchemasOnStart() const;
 
+    /** Should the settings of configurations not applied for a while be compressed ?
+     *
+     * Idle configurations are compressed each time configurations are applied, their settings
+     * are transparently inflated back on their next use.
+     *
+     * @param[in] bCompress: If set to true, idle configuration settings are compressed.
+     *                       If set to false, no compression happens (default behaviour).
+     * @param[in] idleDelayMs: time in milliseconds after which a configuration that has not
+     *                         been applied is considered idle.
+     */
+    void setSettingsCompression(bool bCompress, uint32_t idleDelayMs);
+
+    /** Are the settings of configurations not applied for a while compressed ?
+     *
+     * @param[out] idleDelayMs time in milliseconds after which a configuration that has not
+     *                         been applied is considered idle.
+     * @return true if idle configuration settings are compressed
+     */
+    bool getSettingsCompression(uint32_t &idleDelayMs) const;
+
+    /** Should the settings loaded from a settings image only be copied out of it on first use ?
+     *
+     * @param[in] bLazy: If set to true, the settings image is kept in memory and the settings
+     *                   of a configuration are copied out of it on their first use.
+     *                   If set to false, all settings are copied on start (default behaviour).
+     * @param[in] bWarmUp: If set to true, the settings not used yet are copied by a background
+     *                     thread once started.
+     */
+    void setLazySettingsLoading(bool bLazy, bool bWarmUp);
+
+    /** Are the settings loaded from a settings image only copied out of it on first use ?
+     *
+     * @param[out] bWarmUp true if the settings not used yet are copied in the background
+     * @return true if settings are lazily loaded
+     */
+    bool getLazySettingsLoading(bool &bWarmUp) const;
+
+    /** How many subsystems may be back synchronized concurrently on start ?
+     *
+     * Only thread-safe subsystems are back synchronized concurrently, see
+     * CSubsystem::isThreadSafe, the others are back synchronized one after the other.
+     *
+     * @param[in] concurrency the number of back synchronization threads,
+     *                        1 for no concurrency (default behaviour)
+     */
+    void setBackSynchronizationConcurrency(size_t concurrency);
+    size_t getBackSynchronizationConcurrency() const;
+
+    /** How many subsystems may be mapped concurrently on start ?
+     *
+     * Only thread-safe subsystems are mapped concurrently, see CSubsystem::isThreadSafe, the
+     * others are mapped one after the other.
+     *
+     * @param[in] concurrency the number of mapping threads, 1 for no concurrency,
+     *                        the number of hardware threads by default
+     */
+    void setMappingConcurrency(size_t concurrency);
+    size_t getMappingConcurrency() const;
+
+    /** Should the runtime state be checkpointed, for the next start to skip the back
+     * synchronization and the forced application of the configurations ?
+     *
+     * The checkpoint is only restored by a framework started from the same structure and
+     * domains files. It is no longer written once the tuning mode has been turned on, as the
+     * settings may then differ from the domains file.
+     *
+     * @param[in] path the checkpoint file, empty for no checkpoint (default behaviour)
+     * @param[in] periodMs 0 to write the checkpoint after each configuration application,
+     *                     otherwise the period at which a background thread writes it if the
+     *                     runtime state changed, parameters set between applications included
+     */
+    void setRuntimeCheckpoint(const std::string &path, uint32_t periodMs);
+
+    /** @param[out] periodMs the period at which the checkpoint is written, 0 if after each
+     *                       configuration application
+     * @return the checkpoint file, empty if none
+     */
+    const std::string &getRuntimeCheckpoint(uint32_t &periodMs) const;
+
+    /** Get the timing and memory report of the last start phases
+     *
+     * @return one line per phase, the subsystems being detailed under the structure phase
+     */
+    std::string getStartupProfile() const;
+
+    /** Should the startup profile be logged at the end of the start ?
+     *
+     * @param[in] bLog: If set to true, the profile is logged as one info record.
+     *                  If set to false, it is only available on request (default behaviour).
+     */
+    void setStartupProfileLogging(bool bLog);
+
+    /** Is the startup profile logged at the end of the start ?
+     *
+     * @return true if the profile is logged
+     */
+    bool getStartupProfileLogging() const;
+
     //////////// Tuning /////////////
     /**
      * Activate / deactivate the tuning mode.
@@ -366,6 +526,19 @@ public:
     bool exportSingleDomainXml(std::string &xmlDest, const std::string &domainName,
                                bool withSettings, bool toFile, std::string &errorMsg) const;
 
+    /**
+      * Method that exports Configurable Domains and their settings to a binary settings image.
+      *
+      * The image can then be referred to by the SettingsImageFileLocation element of the
+      * framework configuration, so that the next starts skip the domains XML parsing.
+      *
+      * @param[in] imagePath the path of the image file to write
+      * @param[out] errorMsg is used as the error output
+      *
+      * @return false if any error occurs, true otherwise.
+      */
+    bool exportSettingsImage(const std::string &imagePath, std::string &errorMsg) const;
+
     /**
       * Method that exports an Xml description of the passed element into a string
       *
@@ -425,6 +598,8 @@ private:
     /// Status
     CCommandHandler::CommandStatus statusCommandProcess(const IRemoteCommand &remoteCommand,
                                                         std::string &strResult);
+    CCommandHandler::CommandStatus showStartupProfileCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     /// Tuning Mode
     CCommandHandler::CommandStatus setTuningModeCommandProcess(const IRemoteCommand &remoteCommand,
                                                                std::string &strResult);
@@ -498,11 +673,23 @@ private:
                                                            std::string &strResult);
     CCommandHandler::CommandStatus getRuleCommandProcess(const IRemoteCommand &remoteCommand,
                                                          std::string &strResult);
+    CCommandHandler::CommandStatus diffConfigurationsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus showSettingsMemoryCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus setSettingsCompressionCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus getSettingsCompressionCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     /// Elements/Parameters
     CCommandHandler::CommandStatus listElementsCommandProcess(const IRemoteCommand &remoteCommand,
                                                               std::string &strResult);
     CCommandHandler::CommandStatus listParametersCommandProcess(const IRemoteCommand &remoteCommand,
                                                                 std::string &strResult);
+    CCommandHandler::CommandStatus getEpochCommandProcess(const IRemoteCommand &remoteCommand,
+                                                          std::string &strResult);
+    CCommandHandler::CommandStatus getChangedSinceCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     CCommandHandler::CommandStatus getElementStructureXMLCommandProcess(
         const IRemoteCommand &remoteCommand, std::string &strResult);
     CCommandHandler::CommandStatus getElementBytesCommandProcess(
@@ -562,6 +749,10 @@ private:
         const IRemoteCommand &remoteCommand, std::string &result);
     CCommandHandler::CommandStatus importDomainWithSettingsXMLCommandProcess(
         const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus exportSettingsImageCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus reloadSettingsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
 
     /**
       * Command handler method for getDomainsWithSettings command.
@@ -638,6 +829,10 @@ private:
     // Parameter access
     bool accessValue(CParameterAccessContext &parameterAccessContext, const std::string &strPath,
                      std::string &strValue, bool bSet, std::string &strError);
+    // Must be called with the blackboard mutex locked
+    bool doAccessValue(CParameterAccessContext &parameterAccessContext,
+                       const std::string &strPath, std::string &strValue, bool bSet,
+                       std::string &strError);
     bool doSetValue(const std::string &strPath, const std::string &strValue, bool bRawValueSpace,
                     bool bDynamicAccess, std::string &strError) const;
     bool doGetValue(const std::string &strPath, std::string &strValue, bool bRawValueSpace,
@@ -658,7 +853,15 @@ private:
 
     // System class Structure loading
     bool loadSettings(std::string &strError);
-    bool loadSettingsFromConfigFile(std::string &strError);
+    bool loadSettingsFromConfigFile(CConfigurableDomains &configurableDomains,
+                                    std::string &strError);
+
+    /** Get the configured location of a settings file
+     *
+     * @param[in] kind the kind of the location element in the SettingsConfiguration element
+     * @return the location URI, empty if not configured
+     */
+    std::string getSettingsFileUri(const std::string &kind) const;
 
     /** Get settings from a configurable element in binary format.
      *
@@ -804,7 +1007,7 @@ private:
 
     // Framework Configuration
     CParameterFrameworkConfiguration *getFrameworkConfiguration();
-    const CParameterFrameworkConfiguration *getConstFrameworkConfiguration();
+    const CParameterFrameworkConfiguration *getConstFrameworkConfiguration() const;
 
     // Selection Criteria
     CSelectionCriteria *getSelectionCriteria();
@@ -822,6 +1025,62 @@ private:
     // Apply configurations
     void doApplyConfigurations(bool bForce);
 
+    /** Back synchronize the areas of the main blackboard not covered by any domain
+     *
+     * Subsystems are back synchronized concurrently if allowed.
+     */
+    void backSynchronize();
+
+    /** Copy the settings left in the settings image, one domain at a time
+     *
+     * Run by the background settings warm-up, locks the blackboard mutex.
+     */
+    void warmUpSettings();
+
+    /** Stop the background settings warm-up, if running, and wait for it
+     *
+     * The settings left in the image are then materialized on their first use.
+     */
+    void stopSettingsWarmUp();
+
+    /** Restore the runtime checkpoint, if captured with the same structure and domains file
+     *
+     * @return true if the runtime state has been restored, false otherwise
+     */
+    bool restoreRuntimeCheckpoint();
+
+    /** Write the runtime checkpoint, unless the runtime state did not change since the last one
+     *
+     * Must be called with the blackboard mutex locked once started.
+     */
+    void writeRuntimeCheckpoint();
+
+    /** Write the runtime checkpoint every _checkpointPeriodMs until stopped
+     *
+     * Run by the background checkpoint writer, locks the blackboard mutex.
+     */
+    void writeRuntimeCheckpointPeriodically();
+
+    /** Parameter changes to notify to a subscriber */
+    struct SChangeNotification
+    {
+        ElementHandle::ChangeCallback callback;
+        std::vector<std::string> changedParameters;
+    };
+    using ChangeNotifications = std::vector<SChangeNotification>;
+
+    /** Apply configurations and list the parameter changes to notify
+     *
+     * Must be called with the blackboard mutex locked.
+     *
+     * @param[in] bForce whether to apply configurations even if they are already applied
+     * @return the notifications to send once the blackboard mutex is unlocked
+     */
+    ChangeNotifications doApplyConfigurationsAndListChanges(bool bForce);
+
+    // Send parameter change notifications, blackboard mutex must be unlocked
+    static void notifyChanges(const ChangeNotifications &notifications);
+
     // Dynamic object creation libraries feeding
     void feedElementLibraries();
 
@@ -846,6 +1105,10 @@ private:
     // Tuning
     bool _bTuningModeIsOn{false};
 
+    /** Incremented under the blackboard mutex when the domains may have changed out of the
+     * tuning mode, ie on leaving it or reloading the settings. */
+    uint32_t _domainsRevision{0};
+
     // Value Space
     bool _bValueSpaceIsRaw{false};
 
@@ -858,6 +1121,9 @@ private:
     // Current Parameter Settings
     CParameterBlackboard *_pMainParameterBlackboard;
 
+    /** Element libraries and subsystem types shared with other frameworks */
+    std::shared_ptr<CParameterMgrModel> _model;
+
     // Dynamic object creation
     CElementLibrarySet *_pElementLibrarySet;
 
@@ -877,8 +1143,11 @@ private:
     // Maximum command usage length
     size_t _maxCommandUsageLength{0};
 
-    // Blackboard access mutex
-    std::mutex _blackboardMutex;
+    /** Blackboard access mutex.
+     * Also guards the configuration settings, which applications may compress: readers of the
+     * domain settings, const ones included, lock it.
+     */
+    mutable std::mutex _blackboardMutex;
 
     /** Application main logger based on the one provided by the client */
     mutable core::log::Logger _logger;
@@ -905,4 +1174,68 @@ private:
      * If set to false, no .xml/xsd validation will happen (default behaviour)
      */
     bool _bValidateSchemasOnStart{false};
+
+    /** If set to true, the settings of configurations that have not been applied
+     * for _settingsCompressionDelayMs are compressed. Guarded by the blackboard mutex.
+     */
+    bool _bSettingsCompression{false};
+    uint32_t _settingsCompressionDelayMs{0};
+
+    /** If set to true, the settings loaded from a settings image are copied out of it on first
+     * use, and by a background warm-up if _bSettingsWarmUp is also set.
+     */
+    bool _bLazySettingsLoading{false};
+    bool _bSettingsWarmUp{false};
+
+    // Number of subsystems back synchronized concurrently on start
+    size_t _backSyncConcurrency{1};
+
+    // Number of subsystems mapped concurrently on start
+    size_t _mappingConcurrency{std::thread::hardware_concurrency()};
+
+    /** Hash of the loaded structure, see CSettingsImage::hashStructure, computed once per load
+     * or restored from the structure image
+     */
+    uint64_t _structureHash{0};
+
+    // Timing and memory report of the start phases
+    CStartupProfile _startupProfile;
+    bool _bLogStartupProfile{false};
+
+    // Background settings warm-up, stopped on destruction
+    std::future<void> _settingsWarmUp;
+    std::atomic<bool> _bStopSettingsWarmUp{false};
+
+    // Runtime checkpoint file, none if empty, and its writing period, 0 for each application
+    std::string _checkpointPath;
+    uint32_t _checkpointPeriodMs{0};
+
+    /** Hash of the structure and domains file the checkpoint is tagged with */
+    uint64_t _checkpointTag{0};
+
+    /** False until the tag is known, and once the settings may differ from the domains file */
+    bool _bCheckpointEnabled{false};
+
+    /** Content of the checkpoint last written or restored, not to write it again */
+    std::vector<uint8_t> _lastCheckpoint;
+
+    // Background periodic checkpoint writer, stopped on destruction
+    std::future<void> _checkpointWriter;
+    std::mutex _checkpointWriterMutex;
+    std::condition_variable _checkpointWriterStop;
+    bool _bStopCheckpointWriter{false};
+
+    /** Parameter change subscription */
+    struct SChangeSubscription
+    {
+        const CConfigurableElement *element;
+        ElementHandle::ChangeCallback callback;
+    };
+    std::map<ElementHandle::SubscriptionId, SChangeSubscription> _changeSubscriptions;
+    ElementHandle::SubscriptionId _lastChangeSubscriptionId{0};
+
+    /** Change subscriptions access mutex.
+     * Independent from the blackboard mutex as notified callbacks may (un)subscribe.
+     */
+    std::mutex _changeSubscriptionsMutex;
 };
@@ -42,6 +42,12 @@ CParameterMgrFullConnector::CParameterMgrFullConnector(const string &strConfigur
 {
 }
 
+CParameterMgrFullConnector::CParameterMgrFullConnector(const string &strConfigurationFilePath,
+                                                       std::shared_ptr<CParameterMgrModel> model)
+    : CParameterMgrPlatformConnector(strConfigurationFilePath, model)
+{
+}
+
 CommandHandlerInterface *CParameterMgrFullConnector::createCommandHandler()
 {
     return new CommandHandlerWrapper(_pParameterMgr->createCommandHandler());
@@ -284,3 +290,9 @@ bool CParameterMgrFullConnector::exportSingleDomainXml(string &strXmlDest,
     return _pParameterMgr->exportSingleDomainXml(strXmlDest, strDomainName, bWithSettings, bToFile,
                                                  strError);
 }
+
+bool CParameterMgrFullConnector::exportSettingsImage(const string &strImagePath,
+                                                     string &strError) const
+{
+    return _pParameterMgr->exportSettingsImage(strImagePath, strError);
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ParameterMgrModel.h"
+#include "ElementLibrary.h"
+#include "NamedElementBuilderTemplate.h"
+#include "KindElementBuilderTemplate.h"
+#include "ElementBuilderTemplate.h"
+#include "ParameterFrameworkConfiguration.h"
+#include "SubsystemPlugins.h"
+#include "PluginLocation.h"
+#include "FrameworkConfigurationLocation.h"
+#include "FrameworkConfigurationGroup.h"
+#include "ComponentType.h"
+#include "ComponentInstance.h"
+#include "BitParameterType.h"
+#include "BitParameterBlockType.h"
+#include "StringParameterType.h"
+#include "ParameterBlockType.h"
+#include "BooleanParameterType.h"
+#include "IntegerParameterType.h"
+#include "LinearParameterAdaptation.h"
+#include "LogarithmicParameterAdaptation.h"
+#include "EnumParameterType.h"
+#include "EnumValuePair.h"
+#include "FixedPointParameterType.h"
+#include "FloatingPointParameterType.h"
+#include "ConfigurableDomain.h"
+#include "DomainConfiguration.h"
+#include "CompoundRule.h"
+#include "SelectionCriterionRule.h"
+
+CParameterMgrModel::CParameterMgrModel()
+    : _frameworkConfigurationLibrary(std::make_shared<CElementLibrary>()),
+      _typeLibrary(std::make_shared<CElementLibrary>()),
+      _configurationLibrary(std::make_shared<CElementLibrary>())
+{
+    // Global Configuration handling
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "ParameterFrameworkConfiguration",
+        new TElementBuilderTemplate<CParameterFrameworkConfiguration>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "SubsystemPlugins", new TKindElementBuilderTemplate<CSubsystemPlugins>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "Location", new TKindElementBuilderTemplate<CPluginLocation>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "StructureDescriptionFileLocation",
+        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "StructureImageFileLocation",
+        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "SettingsConfiguration", new TKindElementBuilderTemplate<CFrameworkConfigurationGroup>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "ConfigurableDomainsFileLocation",
+        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
+    _frameworkConfigurationLibrary->addElementBuilder(
+        "SettingsImageFileLocation",
+        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
+
+    // Types
+    _typeLibrary->addElementBuilder("ComponentType",
+                                    new TNamedElementBuilderTemplate<CComponentType>());
+    _typeLibrary->addElementBuilder("Component",
+                                    new TNamedElementBuilderTemplate<CComponentInstance>());
+    _typeLibrary->addElementBuilder("BitParameter",
+                                    new TNamedElementBuilderTemplate<CBitParameterType>());
+    _typeLibrary->addElementBuilder("BitParameterBlock",
+                                    new TNamedElementBuilderTemplate<CBitParameterBlockType>());
+    _typeLibrary->addElementBuilder("StringParameter",
+                                    new TNamedElementBuilderTemplate<CStringParameterType>());
+    _typeLibrary->addElementBuilder("ParameterBlock",
+                                    new TNamedElementBuilderTemplate<CParameterBlockType>());
+    _typeLibrary->addElementBuilder("BooleanParameter",
+                                    new TNamedElementBuilderTemplate<CBooleanParameterType>());
+    _typeLibrary->addElementBuilder("IntegerParameter",
+                                    new TNamedElementBuilderTemplate<CIntegerParameterType>());
+    _typeLibrary->addElementBuilder("LinearAdaptation",
+                                    new TElementBuilderTemplate<CLinearParameterAdaptation>());
+    _typeLibrary->addElementBuilder(
+        "LogarithmicAdaptation", new TElementBuilderTemplate<CLogarithmicParameterAdaptation>());
+    _typeLibrary->addElementBuilder("EnumParameter",
+                                    new TNamedElementBuilderTemplate<CEnumParameterType>());
+    _typeLibrary->addElementBuilder("ValuePair", new TElementBuilderTemplate<CEnumValuePair>());
+    _typeLibrary->addElementBuilder(
+        "FixedPointParameter", new TNamedElementBuilderTemplate<CFixedPointParameterType>());
+    _typeLibrary->addElementBuilder(
+        "FloatingPointParameter", new TNamedElementBuilderTemplate<CFloatingPointParameterType>);
+
+    // Parameter Configuration Domains creation
+    _configurationLibrary->addElementBuilder("ConfigurableDomain",
+                                             new TElementBuilderTemplate<CConfigurableDomain>());
+    _configurationLibrary->addElementBuilder(
+        "Configuration", new TNamedElementBuilderTemplate<CDomainConfiguration>());
+    _configurationLibrary->addElementBuilder("CompoundRule",
+                                             new TElementBuilderTemplate<CCompoundRule>());
+    _configurationLibrary->addElementBuilder(
+        "SelectionCriterionRule", new TElementBuilderTemplate<CSelectionCriterionRule>());
+}
+
+CParameterMgrModel::~CParameterMgrModel()
+{
+}
+
+std::shared_ptr<const CElementLibrary> CParameterMgrModel::getFrameworkConfigurationLibrary() const
+{
+    return _frameworkConfigurationLibrary;
+}
+
+std::shared_ptr<const CElementLibrary> CParameterMgrModel::getTypeLibrary() const
+{
+    return _typeLibrary;
+}
+
+std::shared_ptr<const CElementLibrary> CParameterMgrModel::getConfigurationLibrary() const
+{
+    return _configurationLibrary;
+}
+
+std::shared_ptr<const void> CParameterMgrModel::findSubsystemTypes(uint64_t key) const
+{
+    std::lock_guard<std::mutex> lock(_subsystemTypesMutex);
+    auto types = _subsystemTypes.find(key);
+
+    if (types == _subsystemTypes.end()) {
+
+        return nullptr;
+    }
+    return types->second.lock();
+}
+
+void CParameterMgrModel::shareSubsystemTypes(uint64_t key,
+                                             const std::shared_ptr<const void> &types)
+{
+    std::lock_guard<std::mutex> lock(_subsystemTypesMutex);
+    _subsystemTypes[key] = types;
+}
+
+void CParameterMgrModel::forgetSubsystemTypes(uint64_t key)
+{
+    std::lock_guard<std::mutex> lock(_subsystemTypesMutex);
+    auto types = _subsystemTypes.find(key);
+
+    // The entry may already hold the types parsed again by another subsystem
+    if (types != _subsystemTypes.end() && types->second.expired()) {
+
+        _subsystemTypes.erase(types);
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+class CElementLibrary;
+
+/** Immutable parts of the frameworks of a process, shared by the connectors built from it
+ *
+ * The model holds the element libraries which are independent of the framework configuration:
+ * the builders of the framework configuration, of the parameter types and of the domains,
+ * including their configuration rules. It also holds the subsystem types (component library
+ * and instance definition) parsed by its frameworks, so that a framework loading a subsystem
+ * of the same XML as another one still alive reuses its types instead of building a copy.
+ *
+ * Rules themselves, instances, blackboards, criteria and subsystem objects remain per
+ * framework, rules referring to the criteria of their framework.
+ */
+class CParameterMgrModel : public std::enable_shared_from_this<CParameterMgrModel>
+{
+public:
+    CParameterMgrModel();
+    ~CParameterMgrModel();
+
+    /** @return the builders of the framework configuration elements */
+    std::shared_ptr<const CElementLibrary> getFrameworkConfigurationLibrary() const;
+
+    /** @return the builders of the component types and of the parameter types, see
+     *          CElementLibrary::setFallback
+     */
+    std::shared_ptr<const CElementLibrary> getTypeLibrary() const;
+
+    /** @return the builders of the domains, of their configurations and rules */
+    std::shared_ptr<const CElementLibrary> getConfigurationLibrary() const;
+
+    /** @return the subsystem types shared under a key, NULL if none is alive
+     *
+     * @param[in] key the hash of the subsystem XML, see CXmlElement::hash
+     */
+    std::shared_ptr<const void> findSubsystemTypes(uint64_t key) const;
+
+    /** Share subsystem types with the subsystems of the same XML loaded later
+     *
+     * @param[in] key the hash of the subsystem XML
+     * @param[in] types the types, whose deleter is expected to call forgetSubsystemTypes
+     */
+    void shareSubsystemTypes(uint64_t key, const std::shared_ptr<const void> &types);
+
+    /** Forget the subsystem types shared under a key once released */
+    void forgetSubsystemTypes(uint64_t key);
+
+private:
+    CParameterMgrModel(const CParameterMgrModel &) = delete;
+    CParameterMgrModel &operator=(const CParameterMgrModel &) = delete;
+
+    std::shared_ptr<CElementLibrary> _frameworkConfigurationLibrary;
+    std::shared_ptr<CElementLibrary> _typeLibrary;
+    std::shared_ptr<CElementLibrary> _configurationLibrary;
+
+    /** Types of the subsystems alive, by hash of their subsystem XML */
+    mutable std::mutex _subsystemTypesMutex;
+    std::map<uint64_t, std::weak_ptr<const void>> _subsystemTypes;
+};
@@ -30,15 +30,27 @@
 #include "ParameterMgrPlatformConnector.h"
 #include "ParameterMgr.h"
 #include "ParameterMgrLogger.h"
+#include "ParameterMgrModel.h"
 #include <assert.h>
 
 using std::string;
 
+std::shared_ptr<CParameterMgrModel> CParameterMgrPlatformConnector::createModel()
+{
+    return std::make_shared<CParameterMgrModel>();
+}
+
 // Construction
 CParameterMgrPlatformConnector::CParameterMgrPlatformConnector(
     const string &strConfigurationFilePath)
+    : CParameterMgrPlatformConnector(strConfigurationFilePath, createModel())
+{
+}
+
+CParameterMgrPlatformConnector::CParameterMgrPlatformConnector(
+    const string &strConfigurationFilePath, std::shared_ptr<CParameterMgrModel> model)
     : _pParameterMgrLogger(new CParameterMgrLogger<CParameterMgrPlatformConnector>(*this)),
-      _pParameterMgr(new CParameterMgr(strConfigurationFilePath, *_pParameterMgrLogger)),
+      _pParameterMgr(new CParameterMgr(strConfigurationFilePath, model, *_pParameterMgrLogger)),
       _bStarted(false), _pLogger(NULL)
 {
 }
@@ -82,6 +94,19 @@ void CParameterMgrPlatformConnector::applyConfigurations()
     _pParameterMgr->applyConfigurations();
 }
 
+// Settings reloading
+bool CParameterMgrPlatformConnector::reloadSettings(string &strError)
+{
+    if (!_bStarted) {
+
+        strError = "Can not reload settings before start";
+        return false;
+    }
+    string strChanges;
+
+    return _pParameterMgr->reloadSettings(strChanges, strError);
+}
+
 // Dynamic parameter handling
 CParameterHandle *CParameterMgrPlatformConnector::createParameterHandle(const string &strPath,
                                                                         string &strError) const
@@ -97,6 +122,22 @@ ElementHandle *CParameterMgrPlatformConnector::createElementHandle(const string
     return _pParameterMgr->createElementHandle(strPath, strError);
 }
 
+template <class T>
+ScalarHandle<T> *CParameterMgrPlatformConnector::createScalarHandle(const string &path,
+                                                                    string &error) const
+{
+    assert(_bStarted);
+
+    return _pParameterMgr->createScalarHandle<T>(path, error);
+}
+
+template PARAMETER_EXPORT ScalarHandle<uint32_t> *CParameterMgrPlatformConnector::
+    createScalarHandle(const string &, string &) const;
+template PARAMETER_EXPORT ScalarHandle<int32_t> *CParameterMgrPlatformConnector::
+    createScalarHandle(const string &, string &) const;
+template PARAMETER_EXPORT ScalarHandle<bool> *CParameterMgrPlatformConnector::
+    createScalarHandle(const string &, string &) const;
+
 // Logging
 void CParameterMgrPlatformConnector::setLogger(CParameterMgrPlatformConnector::ILogger *pLogger)
 {
@@ -176,6 +217,120 @@ bool CParameterMgrPlatformConnector::getValidateSchemasOnStart() const
     return _pParameterMgr->getValidateSchemasOnStart();
 }
 
+void CParameterMgrPlatformConnector::setSettingsCompression(bool bCompress, uint32_t idleDelayMs)
+{
+    _pParameterMgr->setSettingsCompression(bCompress, idleDelayMs);
+}
+
+bool CParameterMgrPlatformConnector::getSettingsCompression(uint32_t &idleDelayMs) const
+{
+    return _pParameterMgr->getSettingsCompression(idleDelayMs);
+}
+
+bool CParameterMgrPlatformConnector::setLazySettingsLoading(bool bLazy, bool bWarmUp,
+                                                            std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set lazy settings loading while running";
+        return false;
+    }
+
+    _pParameterMgr->setLazySettingsLoading(bLazy, bWarmUp);
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::getLazySettingsLoading(bool &bWarmUp) const
+{
+    return _pParameterMgr->getLazySettingsLoading(bWarmUp);
+}
+
+bool CParameterMgrPlatformConnector::setBackSynchronizationConcurrency(size_t concurrency,
+                                                                       std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set back synchronization concurrency while running";
+        return false;
+    }
+
+    _pParameterMgr->setBackSynchronizationConcurrency(concurrency);
+    return true;
+}
+
+size_t CParameterMgrPlatformConnector::getBackSynchronizationConcurrency() const
+{
+    return _pParameterMgr->getBackSynchronizationConcurrency();
+}
+
+bool CParameterMgrPlatformConnector::setMappingConcurrency(size_t concurrency,
+                                                           std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set mapping concurrency while running";
+        return false;
+    }
+
+    _pParameterMgr->setMappingConcurrency(concurrency);
+    return true;
+}
+
+size_t CParameterMgrPlatformConnector::getMappingConcurrency() const
+{
+    return _pParameterMgr->getMappingConcurrency();
+}
+
+bool CParameterMgrPlatformConnector::setRuntimeCheckpoint(const std::string &path,
+                                                          uint32_t periodMs,
+                                                          std::string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set runtime checkpoint while running";
+        return false;
+    }
+
+    _pParameterMgr->setRuntimeCheckpoint(path, periodMs);
+    return true;
+}
+
+std::string CParameterMgrPlatformConnector::getRuntimeCheckpoint(uint32_t &periodMs) const
+{
+    return _pParameterMgr->getRuntimeCheckpoint(periodMs);
+}
+
+string CParameterMgrPlatformConnector::getStartupProfile() const
+{
+    assert(_bStarted);
+
+    return _pParameterMgr->getStartupProfile();
+}
+
+void CParameterMgrPlatformConnector::setStartupProfileLogging(bool bLog)
+{
+    _pParameterMgr->setStartupProfileLogging(bLog);
+}
+
+bool CParameterMgrPlatformConnector::getStartupProfileLogging() const
+{
+    return _pParameterMgr->getStartupProfileLogging();
+}
+
+uint64_t CParameterMgrPlatformConnector::getEpoch() const
+{
+    assert(_bStarted);
+
+    return _pParameterMgr->getEpoch();
+}
+
+std::vector<string> CParameterMgrPlatformConnector::getChangedSince(uint64_t epoch) const
+{
+    assert(_bStarted);
+
+    return _pParameterMgr->getChangedSince(epoch);
+}
+
 // Start
 bool CParameterMgrPlatformConnector::start(string &strError)
 {
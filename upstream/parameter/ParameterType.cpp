@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ParameterType.h"
+#include "ImageFile.h"
 #include "Parameter.h"
 #include "ArrayParameter.h"
 #include "ParameterAccessContext.h"
@@ -45,7 +46,7 @@ CParameterType::CParameterType(const string &strName) : base(strName)
 }
 
 // Object creation
-void CParameterType::populate(CElement * /*elem*/) const
+void CParameterType::populate(CElement * /*elem*/, utility::Arena & /*arena*/) const
 {
     // Prevent further digging for instantiaton since we're leaf on the strcture tree
 }
@@ -80,6 +81,27 @@ bool CParameterType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
+// Structure image
+void CParameterType::propertiesToImage(CImageWriter &writer) const
+{
+    base::propertiesToImage(writer);
+    writer.writeUInt64(_size);
+    writer.writeString(_strUnit);
+}
+
+bool CParameterType::propertiesFromImage(CImageReader &reader,
+                                         const CComponentLibrary &componentLibrary,
+                                         std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _size = static_cast<size_t>(reader.readUInt64());
+    _strUnit = reader.readString();
+    return true;
+}
+
 // From IXmlSource
 void CParameterType::toXml(CXmlElement &xmlElement,
                            CXmlSerializingContext &serializingContext) const
@@ -126,14 +148,14 @@ uint32_t CParameterType::getDefaultValue() const
 }
 
 // Parameter instantiation
-CInstanceConfigurableElement *CParameterType::doInstantiate() const
+CInstanceConfigurableElement *CParameterType::doInstantiate(utility::Arena &arena) const
 {
     if (isScalar()) {
         // Scalar parameter
-        return new CParameter(getName(), this);
+        return new (arena) CParameter(getName(), this);
     } else {
         // Array Parameter
-        return new CArrayParameter(getName(), this);
+        return new (arena) CArrayParameter(getName(), this);
     }
 }
 
@@ -57,6 +57,11 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
@@ -125,7 +130,7 @@ public:
 
 protected:
     // Object creation
-    virtual void populate(CElement *pElement) const;
+    virtual void populate(CElement *pElement, utility::Arena &arena) const;
     // Size
     void setSize(size_t size);
 
@@ -151,7 +156,7 @@ private:
     void setXmlUnitAttribute(CXmlElement &xmlElement) const;
 
     // Instantiation
-    virtual CInstanceConfigurableElement *doInstantiate() const;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const;
     // Generic Access
     template <typename type>
     void doSignExtend(type &data) const;
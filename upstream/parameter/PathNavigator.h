@@ -38,6 +38,9 @@ class CPathNavigator
 public:
     CPathNavigator(const std::string &strPath);
 
+    // Navigator with nothing left to navigate, for elements already found
+    CPathNavigator() = default;
+
     // Path validity
     bool isPathValid() const;
 
@@ -54,7 +57,7 @@ private:
     void init(const std::string &strPath);
     static bool checkPathFormat(const std::string &strUpl);
 
-    bool _bValid;
+    bool _bValid{true};
     std::vector<std::string> _astrItems;
     size_t _currentIndex{0};
 };
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "RuntimeCheckpoint.h"
+#include "ImageFile.h"
+#include "ParameterBlackboard.h"
+#include "ConfigurableDomains.h"
+#include "ConfigurableDomain.h"
+#include "DomainConfiguration.h"
+#include "SelectionCriteria.h"
+#include "SelectionCriteriaDefinition.h"
+#include "SelectionCriterion.h"
+#include <algorithm>
+#include <utility>
+
+using std::string;
+
+/* Checkpoint layout, all integers being little endian:
+ *  - magic: 8 bytes
+ *  - version: 32 bits
+ *  - tag, payload size and payload hash: 64 bits each
+ *  - payload:
+ *     - main blackboard: its 64 bit size followed by its content
+ *     - domains: their 32 bit count followed, for each domain, by its name and the name of its
+ *       last applied configuration, empty if none
+ *     - criteria: their 32 bit count followed, for each criterion, by its name and its 32 bit
+ *       state
+ *
+ * Strings are stored as their 32 bit size followed by their characters.
+ */
+const char CRuntimeCheckpoint::gMagic[8] = {'P', 'F', 'W', 'C', 'K', 'P', 'T', '\0'};
+const uint32_t CRuntimeCheckpoint::gVersion = 1;
+
+bool CRuntimeCheckpoint::computeTag(uint64_t structureHash, const string &domainsPath,
+                                    uint64_t &tag, string &error)
+{
+    uint64_t domainsHash;
+    if (!CImageFile::hashFile(domainsPath, domainsHash, error)) {
+
+        return false;
+    }
+    // Covers the full type descriptions, a retyped parameter of unchanged size invalidating
+    // the checkpointed blackboard as well
+    CImageWriter hashes;
+    hashes.writeUInt64(structureHash);
+    hashes.writeUInt64(domainsHash);
+
+    tag = CImageFile::hash(hashes.getData().data(), hashes.getData().size());
+    return true;
+}
+
+std::vector<uint8_t> CRuntimeCheckpoint::capture(uint64_t tag,
+                                                 const CParameterBlackboard &mainBlackboard,
+                                                 const CConfigurableDomains &domains,
+                                                 const CSelectionCriteria &criteria)
+{
+    CImageWriter payload;
+
+    std::vector<uint8_t> blackboard(mainBlackboard.getSize());
+    mainBlackboard.readBuffer(blackboard.data(), blackboard.size(), 0);
+    payload.writeUInt64(blackboard.size());
+    payload.writeBytes(blackboard.data(), blackboard.size());
+
+    size_t nbDomains = domains.getNbChildren();
+    payload.writeUInt32(static_cast<uint32_t>(nbDomains));
+
+    for (size_t child = 0; child < nbDomains; child++) {
+
+        const CConfigurableDomain *domain =
+            static_cast<const CConfigurableDomain *>(domains.getChild(child));
+        const CDomainConfiguration *lastApplied = domain->getLastAppliedConfiguration();
+
+        payload.writeString(domain->getName());
+        payload.writeString(lastApplied != nullptr ? lastApplied->getName() : "");
+    }
+
+    const CSelectionCriteriaDefinition *definition = criteria.getSelectionCriteriaDefinition();
+    size_t nbCriteria = definition->getNbChildren();
+    payload.writeUInt32(static_cast<uint32_t>(nbCriteria));
+
+    for (size_t child = 0; child < nbCriteria; child++) {
+
+        const CSelectionCriterion *criterion =
+            static_cast<const CSelectionCriterion *>(definition->getChild(child));
+
+        payload.writeString(criterion->getName());
+        payload.writeUInt32(static_cast<uint32_t>(criterion->getCriterionState()));
+    }
+
+    CImageWriter checkpoint;
+    checkpoint.writeBytes(reinterpret_cast<const uint8_t *>(gMagic), sizeof(gMagic));
+    checkpoint.writeUInt32(gVersion);
+    checkpoint.writeUInt64(tag);
+    checkpoint.writeUInt64(payload.getData().size());
+    checkpoint.writeUInt64(CImageFile::hash(payload.getData().data(), payload.getData().size()));
+    checkpoint.writeBytes(payload.getData().data(), payload.getData().size());
+
+    return checkpoint.getData();
+}
+
+bool CRuntimeCheckpoint::restore(const std::vector<uint8_t> &content, uint64_t tag,
+                                 CParameterBlackboard &mainBlackboard,
+                                 CConfigurableDomains &domains, CSelectionCriteria &criteria,
+                                 string &error)
+{
+    CImageReader checkpoint(content.data(), content.size());
+
+    // Header
+    const uint8_t *magic = checkpoint.readBytes(sizeof(gMagic));
+    if (magic == NULL || !std::equal(magic, magic + sizeof(gMagic), gMagic)) {
+
+        error = "Not a runtime checkpoint";
+        return false;
+    }
+    if (checkpoint.readUInt32() != gVersion) {
+
+        error = "Unsupported runtime checkpoint version";
+        return false;
+    }
+    if (checkpoint.readUInt64() != tag) {
+
+        error = "Runtime checkpoint captured with another structure or domains file";
+        return false;
+    }
+    uint64_t payloadSize = checkpoint.readUInt64();
+    uint64_t payloadHash = checkpoint.readUInt64();
+    const uint8_t *payloadData = checkpoint.readBytes(payloadSize);
+
+    if (payloadData == NULL || !checkpoint.isAtEnd() ||
+        CImageFile::hash(payloadData, payloadSize) != payloadHash) {
+
+        error = "Corrupted runtime checkpoint";
+        return false;
+    }
+
+    // Payload, fully read before anything is restored
+    CImageReader payload(payloadData, payloadSize);
+
+    uint64_t blackboardSize = payload.readUInt64();
+    if (blackboardSize != mainBlackboard.getSize()) {
+
+        error = "Runtime checkpoint of another blackboard size";
+        return false;
+    }
+    const uint8_t *blackboard = payload.readBytes(blackboardSize);
+
+    std::vector<std::pair<string, string>> lastApplied(payload.readUInt32());
+    for (auto &domain : lastApplied) {
+
+        domain.first = payload.readString();
+        domain.second = payload.readString();
+    }
+    std::vector<std::pair<string, int>> states(payload.readUInt32());
+    for (auto &state : states) {
+
+        state.first = payload.readString();
+        state.second = static_cast<int>(payload.readUInt32());
+    }
+    if (payload.hasFailed() || !payload.isAtEnd()) {
+
+        error = "Inconsistent runtime checkpoint content";
+        return false;
+    }
+
+    for (const auto &domain : lastApplied) {
+
+        CConfigurableDomain *configurableDomain =
+            static_cast<CConfigurableDomain *>(domains.findChild(domain.first));
+
+        if (configurableDomain == nullptr) {
+
+            error = "Runtime checkpoint refers to unknown domain " + domain.first;
+            return false;
+        }
+        if (!configurableDomain->setLastAppliedConfiguration(domain.second, error)) {
+
+            return false;
+        }
+    }
+    mainBlackboard.writeBuffer(blackboard, blackboardSize, 0);
+
+    for (const auto &state : states) {
+
+        // Criteria set by the client for this run keep their state
+        CSelectionCriterion *criterion = criteria.getSelectionCriterion(state.first);
+
+        if (criterion != nullptr && !criterion->hasBeenModified()) {
+
+            criterion->setCriterionState(state.second);
+        }
+    }
+    return true;
+}
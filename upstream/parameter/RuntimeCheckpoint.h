@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class CParameterBlackboard;
+class CConfigurableDomains;
+class CSelectionCriteria;
+
+/** Runtime state checkpoint, allowing a restarted framework to skip the hardware accesses of a
+ * cold start
+ *
+ * A checkpoint holds the main blackboard, the last applied configuration of each domain and the
+ * criterion states. It is tagged with the complete structure hash, see
+ * CSettingsImage::hashStructure, and with a hash of the domains file, so that it is only
+ * restored by a framework built from the same files.
+ *
+ * The tag says nothing of the hardware state: a checkpoint outliving a hardware reset (e.g. a
+ * reboot) is trusted blindly, the restored blackboard then no longer matching the hardware.
+ */
+class CRuntimeCheckpoint
+{
+public:
+    /** Compute the tag of the checkpoints
+     *
+     * @param[in] structureHash the hash of the structure, see CSettingsImage::hashStructure
+     * @param[in] domainsPath the path of the domains XML file, empty if none
+     * @param[out] tag the hash of the structure and of the domains file
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    static bool computeTag(uint64_t structureHash, const std::string &domainsPath,
+                           uint64_t &tag, std::string &error);
+
+    /** Capture the runtime state
+     *
+     * @return the content of the checkpoint file
+     */
+    static std::vector<uint8_t> capture(uint64_t tag, const CParameterBlackboard &mainBlackboard,
+                                        const CConfigurableDomains &domains,
+                                        const CSelectionCriteria &criteria);
+
+    /** Restore the runtime state
+     *
+     * The domains get back their last applied configurations without applying them. Only the
+     * criteria that have not been modified since their creation get back their state, the
+     * other ones having been set by the client for this run.
+     *
+     * @param[in] content the content of the checkpoint file
+     * @param[in] tag the tag the checkpoint must have been captured with
+     * @param[out] mainBlackboard the main blackboard to restore
+     * @param[out] domains the domains whose last applied configurations are restored
+     * @param[out] criteria the criteria whose states are restored
+     * @param[out] error human readable error
+     * @return true on success, false otherwise in which case the last applied configurations
+     *         may be partially restored
+     */
+    static bool restore(const std::vector<uint8_t> &content, uint64_t tag,
+                        CParameterBlackboard &mainBlackboard, CConfigurableDomains &domains,
+                        CSelectionCriteria &criteria, std::string &error);
+
+private:
+    static const char gMagic[8];
+    static const uint32_t gVersion;
+};
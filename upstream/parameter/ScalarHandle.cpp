@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ScalarHandle.h"
+#include "BaseParameter.h"
+#include "IntegerParameterType.h"
+#include "BooleanParameterType.h"
+#include "ParameterBlackboard.h"
+#include "ParameterMgr.h"
+#include "Syncer.h"
+
+#include <climits>
+#include <mutex>
+
+using std::string;
+using std::mutex;
+using std::lock_guard;
+
+template <class T>
+ScalarHandle<T>::ScalarHandle(const CBaseParameter &parameter, CParameterMgr &parameterMgr)
+    : mParameter(parameter), mParameterMgr(parameterMgr)
+{
+}
+
+template <class T>
+string ScalarHandle<T>::getPath() const
+{
+    return mParameter.getPath();
+}
+
+// Binding
+/** Resolve the accepted range of an integer parameter, as its type checks it on access. */
+template <class T>
+static bool bindRange(const CTypeElement *typeElement, T &min, T &max, string &error)
+{
+    auto *type = dynamic_cast<const CIntegerParameterType *>(typeElement);
+
+    if (type == nullptr) {
+
+        error = "not an integer parameter";
+        return false;
+    }
+    min = static_cast<T>(type->getMin());
+    max = static_cast<T>(type->getMax());
+
+    return true;
+}
+
+static bool bindRange(const CTypeElement *typeElement, bool &min, bool &max, string &error)
+{
+    if (dynamic_cast<const CBooleanParameterType *>(typeElement) == nullptr) {
+
+        error = "not a boolean parameter";
+        return false;
+    }
+    min = false;
+    max = true;
+
+    return true;
+}
+
+template <class T>
+bool ScalarHandle<T>::bind(string &error)
+{
+    if (!mParameter.isScalar()) {
+
+        error = "Can not bind \"" + getPath() + "\" as it is an array";
+        return false;
+    }
+    if (!bindRange(mParameter.getTypeElement(), mMin, mMax, error)) {
+
+        error = "Can not bind \"" + getPath() + "\": " + error;
+        return false;
+    }
+    mOffset = mParameter.getOffset();
+    mSize = mParameter.getFootPrint();
+    mSyncer = mParameter.getSyncer();
+
+    mRogue = mParameter.isRogue();
+    mDomainsRevision = mParameterMgr._domainsRevision;
+
+    return true;
+}
+
+// Conversion from the blackboard raw values, of the given size
+static void fromRaw(uint32_t raw, size_t /*size*/, uint32_t &value)
+{
+    value = raw;
+}
+
+static void fromRaw(uint32_t raw, size_t size, int32_t &value)
+{
+    // Sign extend
+    size_t shift = CHAR_BIT * (sizeof(raw) - size);
+
+    value = static_cast<int32_t>(raw << shift) >> shift;
+}
+
+static void fromRaw(uint32_t raw, size_t /*size*/, bool &value)
+{
+    value = raw != 0;
+}
+
+// Access
+template <class T>
+bool ScalarHandle<T>::checkRogue(string &error)
+{
+    // Domains may be edited at will while tuning
+    if (mParameterMgr.tuningModeOn()) {
+
+        mRogue = mParameter.isRogue();
+    } else if (mDomainsRevision != mParameterMgr._domainsRevision) {
+
+        mRogue = mParameter.isRogue();
+        mDomainsRevision = mParameterMgr._domainsRevision;
+    }
+    if (!mRogue) {
+
+        error = "Can not set parameter \"" + getPath() + "\" as it is not rogue.";
+        return false;
+    }
+    return true;
+}
+
+template <class T>
+bool ScalarHandle<T>::set(T value, string &error)
+{
+    // Ensure we're safe against blackboard foreign access
+    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+
+    if (!checkRogue(error)) {
+
+        return false;
+    }
+    // When in tuning mode, silently skip "set" requests
+    if (mParameterMgr.tuningModeOn()) {
+
+        return true;
+    }
+    if (value < mMin || value > mMax) {
+
+        error = "Value out of range " + getPath();
+        return false;
+    }
+    CParameterBlackboard *blackboard = mParameterMgr.getParameterBlackboard();
+    uint32_t raw = static_cast<uint32_t>(value);
+
+    // Beware this code works on little endian architectures only!
+    blackboard->writeInteger(&raw, mSize, mOffset);
+
+    // Synchronize
+    if (mSyncer == nullptr) {
+
+        error = "Unable to synchronize modification. No Syncer object associated to "
+                "configurable element: " +
+                getPath();
+        return false;
+    }
+    if (!mSyncer->sync(*blackboard, false, error)) {
+
+        error += " " + getPath();
+        return false;
+    }
+    return true;
+}
+
+template <class T>
+T ScalarHandle<T>::get() const
+{
+    uint32_t raw = 0;
+
+    // Ensure we're safe against blackboard foreign access
+    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+
+    // Beware this code works on little endian architectures only!
+    mParameterMgr.getParameterBlackboard()->readInteger(&raw, mSize, mOffset);
+
+    T value;
+    fromRaw(raw, mSize, value);
+
+    return value;
+}
+
+template class ScalarHandle<uint32_t>;
+template class ScalarHandle<int32_t>;
+template class ScalarHandle<bool>;
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "SettingsImage.h"
+#include "SystemClass.h"
+#include "ConfigurableDomains.h"
+#include "InstanceConfigurableElement.h"
+#include "TypeElement.h"
+#include "StructureImage.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+
+using std::string;
+
+/* Image layout, all integers being little endian:
+ *  - magic: 8 bytes
+ *  - version: 32 bits
+ *  - structure hash, source hash, payload size and payload hash: 64 bits each
+ *  - payload: the configurable domains, see CConfigurableDomains::toImage
+ *
+ * Strings are stored as their 32 bit size followed by their characters.
+ */
+const char CSettingsImage::gMagic[8] = {'P', 'F', 'W', 'S', 'I', 'M', 'G', '\0'};
+const uint32_t CSettingsImage::gVersion = 3;
+
+namespace
+{
+
+/** Write the properties of a type element and of its children
+ *
+ * Every property able to change how settings are stored or checked (size, sign, range, value
+ * pairs, bit fields, array length...) is written by CElement::propertiesToImage.
+ */
+void serializeType(const CTypeElement &type, CImageWriter &writer)
+{
+    writer.writeString(type.getKind());
+    type.propertiesToImage(writer);
+    CStructureImage::childrenToImage(type, writer);
+}
+
+/** Write the structure, the type elements shared by several instances being only described once
+ *
+ * @param[in] element the element to write, along with its descendants
+ * @param[in,out] writer the destination
+ * @param[in,out] types the index of the type elements already described
+ */
+void serializeStructure(const CConfigurableElement &element, CImageWriter &writer,
+                        std::map<const CTypeElement *, uint32_t> &types)
+{
+    writer.writeString(element.getName());
+    writer.writeString(element.getKind());
+    writer.writeUInt64(element.getOffset());
+    writer.writeUInt64(element.getFootPrint());
+
+    auto instance = dynamic_cast<const CInstanceConfigurableElement *>(&element);
+    if (instance != nullptr) {
+
+        auto inserted = types.emplace(instance->getTypeElement(), types.size());
+        writer.writeUInt32(inserted.first->second);
+
+        if (inserted.second) {
+
+            serializeType(*instance->getTypeElement(), writer);
+        }
+    }
+
+    size_t nbChildren = element.getNbChildren();
+    writer.writeUInt32(static_cast<uint32_t>(nbChildren));
+
+    for (size_t child = 0; child < nbChildren; child++) {
+
+        serializeStructure(*static_cast<const CConfigurableElement *>(element.getChild(child)),
+                           writer, types);
+    }
+}
+
+} // namespace
+
+bool CSettingsImage::save(const string &imagePath, const string &sourcePath,
+                          uint64_t structureHash, const CConfigurableDomains &domains,
+                          string &error)
+{
+    uint64_t sourceHash;
+    if (!CImageFile::hashFile(sourcePath, sourceHash, error)) {
+
+        return false;
+    }
+
+    CImageWriter payload;
+    domains.toImage(payload);
+
+    CImageWriter image;
+    image.writeBytes(reinterpret_cast<const uint8_t *>(gMagic), sizeof(gMagic));
+    image.writeUInt32(gVersion);
+    image.writeUInt64(structureHash);
+    image.writeUInt64(sourceHash);
+    image.writeUInt64(payload.getData().size());
+    image.writeUInt64(CImageFile::hash(payload.getData().data(), payload.getData().size()));
+    image.writeBytes(payload.getData().data(), payload.getData().size());
+
+    return CImageFile::write(imagePath, image.getData(), error);
+}
+
+bool CSettingsImage::load(const string &imagePath, const string &sourcePath,
+                          CSystemClass &systemClass, uint64_t structureHash,
+                          const CSelectionCriteriaDefinition *criteriaDefinition,
+                          CConfigurableDomains &domains, bool bLazy, string &error)
+{
+    // Shared with the configurations whose settings are lazily loaded, and with the other
+    // frameworks of the process loading the same image
+    std::shared_ptr<const std::vector<uint8_t>> content;
+    if (!CImageFile::readShared(imagePath, content, error)) {
+
+        return false;
+    }
+    CImageReader image(content->data(), content->size());
+
+    // Header
+    const uint8_t *magic = image.readBytes(sizeof(gMagic));
+    if (magic == NULL || !std::equal(magic, magic + sizeof(gMagic), gMagic)) {
+
+        error = "Not a settings image";
+        return false;
+    }
+    if (image.readUInt32() != gVersion) {
+
+        error = "Unsupported settings image version";
+        return false;
+    }
+    if (image.readUInt64() != structureHash) {
+
+        error = "Settings image built for another structure";
+        return false;
+    }
+    uint64_t sourceHash;
+    if (!CImageFile::hashFile(sourcePath, sourceHash, error)) {
+
+        return false;
+    }
+    if (image.readUInt64() != sourceHash) {
+
+        error = "Settings image built from another domains file";
+        return false;
+    }
+    uint64_t payloadSize = image.readUInt64();
+    uint64_t payloadHash = image.readUInt64();
+    const uint8_t *payloadData = image.readBytes(payloadSize);
+
+    if (payloadData == NULL || !image.isAtEnd() ||
+        CImageFile::hash(payloadData, payloadSize) != payloadHash) {
+
+        error = "Corrupted settings image";
+        return false;
+    }
+
+    // Payload
+    CImageReader payload(payloadData, payloadSize, bLazy ? content : nullptr);
+
+    if (!domains.fromImage(payload, systemClass, criteriaDefinition, error)) {
+
+        return false;
+    }
+    if (payload.hasFailed() || !payload.isAtEnd()) {
+
+        error = "Inconsistent settings image content";
+        return false;
+    }
+    return true;
+}
+
+uint64_t CSettingsImage::hashStructure(const CSystemClass &systemClass)
+{
+    CImageWriter structure;
+    std::map<const CTypeElement *, uint32_t> types;
+    serializeStructure(systemClass, structure, types);
+
+    return CImageFile::hash(structure.getData().data(), structure.getData().size());
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "ImageFile.h"
+#include <string>
+
+class CSystemClass;
+class CConfigurableDomains;
+class CSelectionCriteriaDefinition;
+
+/** Precompiled binary image of the configurable domains
+ *
+ * The image holds the domains, their associated elements, the configuration rules and the raw
+ * configuration settings, so that they can be restored without parsing the domains XML file.
+ *
+ * An image is only loaded if it was built from the same structure and the same domains file;
+ * any mismatch or corruption makes the load fail so that the caller can fall back to XML.
+ */
+class CSettingsImage
+{
+public:
+    /** Write the image of the configurable domains
+     *
+     * @param[in] imagePath the path of the image file to write
+     * @param[in] sourcePath the path of the domains XML file the domains were loaded from,
+     *                       empty if none
+     * @param[in] structureHash the hash of the structure the domains refer to, see
+     *                          hashStructure
+     * @param[in] domains the domains to save
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    static bool save(const std::string &imagePath, const std::string &sourcePath,
+                     uint64_t structureHash, const CConfigurableDomains &domains,
+                     std::string &error);
+
+    /** Load the configurable domains from an image
+     *
+     * @param[in] imagePath the path of the image file to read
+     * @param[in] sourcePath the path of the domains XML file the image must have been built
+     *                       from, empty if none
+     * @param[in] systemClass the structure the domains refer to
+     * @param[in] structureHash the hash of that structure, see hashStructure
+     * @param[in] criteriaDefinition the criteria the configuration rules refer to
+     * @param[out] domains the domains to fill, must be empty
+     * @param[in] bLazy if true, the configuration settings are only copied out of the image
+     *                  on their first use, the image being kept in memory until then
+     * @param[out] error human readable error
+     * @return true on success, false otherwise in which case domains may be partially filled
+     */
+    static bool load(const std::string &imagePath, const std::string &sourcePath,
+                     CSystemClass &systemClass, uint64_t structureHash,
+                     const CSelectionCriteriaDefinition *criteriaDefinition,
+                     CConfigurableDomains &domains, bool bLazy, std::string &error);
+
+    /** Hash of the complete structure description
+     *
+     * Covers the name, kind, offset and footprint of each structure element, and the properties
+     * of its type, so that any change of the structure files able to alter how the settings are
+     * laid out or checked changes the hash. Walks the whole structure: computed once per load.
+     */
+    static uint64_t hashStructure(const CSystemClass &systemClass);
+
+private:
+    static const char gMagic[8];
+    static const uint32_t gVersion;
+};
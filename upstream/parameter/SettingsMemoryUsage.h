@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "ParameterBlackboard.h"
+
+#include <chrono>
+#include <cstddef>
+#include <set>
+
+/** Accounting of the memory used by configuration settings */
+struct SSettingsMemoryUsage
+{
+    /** Account for the settings held by a configuration blackboard */
+    void account(const CParameterBlackboard &blackboard)
+    {
+        size_t size = blackboard.getSize();
+
+        ++areaCount;
+        settingsSize += size;
+
+        const void *payload = blackboard.getSharedPayload();
+
+        // Shared payloads are only stored once
+        if (payload == nullptr || sharedPayloads.insert(payload).second) {
+
+            storedSize += size;
+        }
+    }
+
+    /** Number of area configurations */
+    size_t areaCount{0};
+    /** Bytes the settings would need if each area configuration held a private copy */
+    size_t settingsSize{0};
+    /** Bytes actually stored */
+    size_t storedSize{0};
+    /** Shared payloads already accounted for */
+    std::set<const void *> sharedPayloads;
+
+    /** Number of domain configurations whose settings are compressed */
+    size_t compressedConfigurationCount{0};
+    /** Bytes the compressed settings need once inflated, included in settingsSize */
+    size_t compressedSettingsSize{0};
+    /** Bytes used by compressed settings, not included in storedSize */
+    size_t compressedSize{0};
+
+    /** Number of domain configurations whose settings are still in the settings image,
+     * not accounted for in the sizes */
+    size_t pendingConfigurationCount{0};
+
+    /** Number of compressed settings inflations */
+    size_t inflationCount{0};
+    /** Cumulated and longest inflation durations */
+    std::chrono::microseconds inflationDuration{0};
+    std::chrono::microseconds maxInflationDuration{0};
+};
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "StartupProfile.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+using std::string;
+using std::chrono::microseconds;
+
+CStartupProfile::CScope::CScope(CStartupProfile *profile, const string &name, bool bConcurrent)
+    : mProfile(profile), mConcurrent(bConcurrent), mPhase(0)
+{
+    if (mProfile == nullptr) {
+
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mProfile->mMutex);
+
+        mPhase = mProfile->mPhases.size();
+        SPhase phase;
+        phase.name = name;
+        // Concurrent phases are siblings: they do not nest
+        phase.depth = mConcurrent ? mProfile->mDepth : mProfile->mDepth++;
+        mProfile->mPhases.push_back(phase);
+    }
+    mPeakRssStart = getPeakRss();
+    if (mConcurrent) {
+
+        mThreadCpuStart = getThreadCpuTime();
+    } else {
+
+        mCpuStart = std::clock();
+    }
+    mWallStart = std::chrono::steady_clock::now();
+}
+
+CStartupProfile::CScope::~CScope()
+{
+    if (mProfile == nullptr) {
+
+        return;
+    }
+    auto wallEnd = std::chrono::steady_clock::now();
+    microseconds cpuTime;
+    if (mConcurrent) {
+
+        cpuTime = getThreadCpuTime() - mThreadCpuStart;
+    } else {
+
+        // Convert in floating point: a 32-bit clock_t scaled to microseconds would overflow
+        cpuTime = microseconds(static_cast<microseconds::rep>(double(std::clock() - mCpuStart) *
+                                                              1000000 / CLOCKS_PER_SEC));
+    }
+    size_t peakRssGrowth = getPeakRss() - mPeakRssStart;
+
+    std::lock_guard<std::mutex> lock(mProfile->mMutex);
+    SPhase &phase = mProfile->mPhases[mPhase];
+
+    phase.wallTime = std::chrono::duration_cast<microseconds>(wallEnd - mWallStart);
+    phase.cpuTime = cpuTime;
+    phase.peakRssGrowth = peakRssGrowth;
+
+    if (!mConcurrent) {
+
+        mProfile->mDepth--;
+    }
+}
+
+void CStartupProfile::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mPhases.clear();
+    mDepth = 0;
+}
+
+const std::vector<CStartupProfile::SPhase> &CStartupProfile::getPhases() const
+{
+    return mPhases;
+}
+
+string CStartupProfile::toString() const
+{
+    string report;
+
+    for (const auto &phase : mPhases) {
+
+        report += string(phase.depth * 4, ' ') + phase.name + ": wall " +
+                  std::to_string(phase.wallTime.count()) + " us, cpu " +
+                  std::to_string(phase.cpuTime.count()) + " us, peak RSS +" +
+                  std::to_string(phase.peakRssGrowth) + " KiB\n";
+    }
+    return report;
+}
+
+size_t CStartupProfile::getPeakRss()
+{
+#ifndef _WIN32
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+
+        return 0;
+    }
+#ifdef __APPLE__
+    // Reported in bytes
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+microseconds CStartupProfile::getThreadCpuTime()
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec time;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+
+        return microseconds(0);
+    }
+    return microseconds(static_cast<microseconds::rep>(time.tv_sec) * 1000000 +
+                        time.tv_nsec / 1000);
+#else
+    return microseconds(0);
+#endif
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/** Timing and memory report of the phases of the parameter framework start
+ *
+ * Measuring a phase only costs a few clock readings and a resource usage query, so that the
+ * profile can always be collected. Phases may be measured from several threads.
+ */
+class CStartupProfile
+{
+public:
+    struct SPhase
+    {
+        std::string name;
+        /** Nesting level, sub-phases following their parent phase */
+        size_t depth;
+        std::chrono::microseconds wallTime{0};
+        /** Process CPU time, all threads included, or the CPU time of its thread for a
+         * concurrent phase */
+        std::chrono::microseconds cpuTime{0};
+        /** Growth of the process peak resident set size, in KiB, 0 if unknown */
+        size_t peakRssGrowth{0};
+    };
+
+    /** Measures a phase from its construction to its destruction
+     *
+     * Phases measured while another is being measured are its sub-phases. Concurrent phases
+     * are sub-phases of the phase being measured that may overlap each other, they are
+     * recorded in the order they start and may not have sub-phases.
+     */
+    class CScope
+    {
+    public:
+        /** @param[in] profile the profile to record the phase to, none if NULL
+         * @param[in] name the phase name
+         * @param[in] bConcurrent true if the phase is measured concurrently with its siblings
+         */
+        CScope(CStartupProfile *profile, const std::string &name, bool bConcurrent = false);
+        ~CScope();
+
+        CScope(const CScope &) = delete;
+        CScope &operator=(const CScope &) = delete;
+
+    private:
+        CStartupProfile *mProfile;
+        bool mConcurrent;
+        size_t mPhase;
+        std::chrono::steady_clock::time_point mWallStart;
+        std::clock_t mCpuStart;
+        std::chrono::microseconds mThreadCpuStart;
+        size_t mPeakRssStart;
+    };
+
+    void clear();
+
+    const std::vector<SPhase> &getPhases() const;
+
+    /** @return one line per phase, sub-phases being indented */
+    std::string toString() const;
+
+private:
+    /** @return the process peak resident set size in KiB, 0 if unknown */
+    static size_t getPeakRss();
+
+    /** @return the CPU time of the calling thread, 0 if unknown */
+    static std::chrono::microseconds getThreadCpuTime();
+
+    /** Guards the phases and the depth while concurrent phases are measured */
+    std::mutex mMutex;
+    std::vector<SPhase> mPhases;
+    size_t mDepth{0};
+};
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "StringParameterType.h"
+#include "ImageFile.h"
 #include "StringParameter.h"
 #include "Utility.h"
 
@@ -67,9 +68,28 @@ bool CStringParameterType::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
-CInstanceConfigurableElement *CStringParameterType::doInstantiate() const
+// Structure image
+void CStringParameterType::propertiesToImage(CImageWriter &writer) const
 {
-    return new CStringParameter(getName(), this);
+    base::propertiesToImage(writer);
+    writer.writeUInt64(_maxLength);
+}
+
+bool CStringParameterType::propertiesFromImage(CImageReader &reader,
+                                               const CComponentLibrary &componentLibrary,
+                                               std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _maxLength = static_cast<size_t>(reader.readUInt64());
+    return true;
+}
+
+CInstanceConfigurableElement *CStringParameterType::doInstantiate(utility::Arena &arena) const
+{
+    return new (arena) CStringParameter(getName(), this);
 }
 
 // Max length
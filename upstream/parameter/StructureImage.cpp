@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "StructureImage.h"
+#include "ImageFile.h"
+#include "ComponentLibrary.h"
+#include "ElementLibrary.h"
+#include "StartupProfile.h"
+#include "Subsystem.h"
+#include "SubsystemLibrary.h"
+#include "SystemClass.h"
+#include <algorithm>
+
+using std::string;
+
+/* Image layout, all integers being little endian:
+ *  - magic: 8 bytes
+ *  - version: 32 bits
+ *  - number of source files: 32 bits, then for each of them its URI and the hash of its stamp:
+ *    64 bits, the top level structure file coming first
+ *  - payload size and payload hash: 64 bits each
+ *  - payload:
+ *    - system class name and description
+ *    - hash of the instantiated structure: 64 bits, see CSettingsImage::hashStructure
+ *    - number of subsystems: 32 bits, then for each of them its type, its name and its
+ *      structure, see CSubsystem::structureToImage
+ *
+ * Strings are stored as their 32 bit size followed by their characters.
+ */
+const char CStructureImage::gMagic[8] = {'P', 'F', 'W', 'S', 'T', 'R', 'C', '\0'};
+const uint32_t CStructureImage::gVersion = 3;
+
+namespace
+{
+
+/** @return the tag of the XML element an element is built from, which selects its builder */
+string getBuilderType(const CElement &element)
+{
+    // Element kinds are their XML tags, but for these
+    string kind = element.getKind();
+
+    if (kind == "ComponentInstance") {
+
+        return "Component";
+    }
+    if (kind == "Adaptation") {
+
+        // Adaptations are named after their type
+        return element.getName() + kind;
+    }
+    return kind;
+}
+
+} // namespace
+
+bool CStructureImage::save(const string &imagePath, const std::vector<string> &sourceUris,
+                           const CSystemClass &systemClass, uint64_t structureHash,
+                           string &error)
+{
+    CImageWriter payload;
+    payload.writeString(systemClass.getName());
+    payload.writeString(systemClass.getDescription());
+    payload.writeUInt64(structureHash);
+
+    size_t nbSubsystems = systemClass.getNbChildren();
+    payload.writeUInt32(static_cast<uint32_t>(nbSubsystems));
+
+    for (size_t index = 0; index < nbSubsystems; index++) {
+
+        const CSubsystem *subsystem = static_cast<const CSubsystem *>(systemClass.getChild(index));
+
+        payload.writeString(subsystem->getType());
+        payload.writeString(subsystem->getName());
+        subsystem->structureToImage(payload);
+    }
+
+    CImageWriter image;
+    image.writeBytes(reinterpret_cast<const uint8_t *>(gMagic), sizeof(gMagic));
+    image.writeUInt32(gVersion);
+    image.writeUInt32(static_cast<uint32_t>(sourceUris.size()));
+
+    for (const auto &sourceUri : sourceUris) {
+
+        uint64_t stampHash;
+        if (!CImageFile::hashStamp(sourceUri, stampHash, error)) {
+
+            return false;
+        }
+        image.writeString(sourceUri);
+        image.writeUInt64(stampHash);
+    }
+    const std::vector<uint8_t> &payloadData = payload.getData();
+    image.writeUInt64(payloadData.size());
+    image.writeUInt64(CImageFile::hash(payloadData.data(), payloadData.size()));
+    image.writeBytes(payloadData.data(), payloadData.size());
+
+    return CImageFile::write(imagePath, image.getData(), error);
+}
+
+bool CStructureImage::load(const string &imagePath, const string &structureUri,
+                           CSystemClass &systemClass, CParameterMgrModel &model,
+                           CStartupProfile *profile, uint64_t &structureHash, string &error)
+{
+    std::vector<uint8_t> content;
+    if (!CImageFile::read(imagePath, content, error)) {
+
+        return false;
+    }
+    CImageReader image(content.data(), content.size());
+
+    // Header
+    const uint8_t *magic = image.readBytes(sizeof(gMagic));
+    if (magic == NULL || !std::equal(magic, magic + sizeof(gMagic), gMagic)) {
+
+        error = "Not a structure image";
+        return false;
+    }
+    if (image.readUInt32() != gVersion) {
+
+        error = "Unsupported structure image version";
+        return false;
+    }
+
+    // Source files, only their stamps are checked
+    size_t nbSources = image.readUInt32();
+
+    for (size_t source = 0; source < nbSources && !image.hasFailed(); source++) {
+
+        string sourceUri = image.readString();
+
+        if (source == 0 && sourceUri != structureUri) {
+
+            error = "Structure image built from another structure file";
+            return false;
+        }
+        uint64_t stampHash;
+        if (!CImageFile::hashStamp(sourceUri, stampHash, error)) {
+
+            return false;
+        }
+        if (image.readUInt64() != stampHash) {
+
+            error = "Structure file " + sourceUri + " changed since the structure image was built";
+            return false;
+        }
+    }
+
+    // Payload
+    uint64_t payloadSize = image.readUInt64();
+    uint64_t payloadHash = image.readUInt64();
+    const uint8_t *payloadData = image.readBytes(payloadSize);
+
+    if (nbSources == 0 || payloadData == NULL || !image.isAtEnd() ||
+        CImageFile::hash(payloadData, payloadSize) != payloadHash) {
+
+        error = "Corrupted structure image";
+        return false;
+    }
+    CImageReader payload(payloadData, payloadSize);
+
+    if (payload.readString() != systemClass.getName()) {
+
+        error = "Structure image built for another system class";
+        return false;
+    }
+    systemClass.setDescription(payload.readString());
+    structureHash = payload.readUInt64();
+
+    size_t nbSubsystems = payload.readUInt32();
+
+    for (size_t index = 0; index < nbSubsystems && !payload.hasFailed(); index++) {
+
+        string type = payload.readString();
+        string name = payload.readString();
+
+        CStartupProfile::CScope profileScope(profile, "Subsystem " + name);
+
+        CSubsystem *subsystem = static_cast<CSubsystem *>(
+            systemClass.getSubsystemLibrary()->createNamedElement(type, name));
+
+        if (subsystem == NULL) {
+
+            error = "Unable to create subsystem " + name + " of type " + type;
+            return false;
+        }
+        systemClass.addChild(subsystem);
+
+        if (!subsystem->structureFromImage(payload, model, systemClass.getInstanceArena(),
+                                           error)) {
+
+            return false;
+        }
+    }
+    if (payload.hasFailed() || !payload.isAtEnd()) {
+
+        error = "Inconsistent structure image content";
+        return false;
+    }
+    return true;
+}
+
+void CStructureImage::childrenToImage(const CElement &parent, CImageWriter &writer)
+{
+    size_t nbChildren = parent.getNbChildren();
+    writer.writeUInt32(static_cast<uint32_t>(nbChildren));
+
+    for (size_t index = 0; index < nbChildren; index++) {
+
+        const CElement *child = parent.getChild(index);
+
+        writer.writeString(getBuilderType(*child));
+        writer.writeString(child->getName());
+        writer.writeString(child->getDescription());
+        child->propertiesToImage(writer);
+        childrenToImage(*child, writer);
+    }
+}
+
+bool CStructureImage::childrenFromImage(CElement &parent, CImageReader &reader,
+                                        const CElementLibrary &library,
+                                        const CComponentLibrary &componentLibrary,
+                                        string &error)
+{
+    size_t nbChildren = reader.readUInt32();
+
+    // Siblings are mostly of the same type, reused strings spare allocating it for each of them
+    string type;
+    string name;
+
+    for (size_t index = 0; index < nbChildren && !reader.hasFailed(); index++) {
+
+        reader.readString(type);
+        reader.readString(name);
+
+        CElement *child = library.createNamedElement(type, name);
+
+        if (child == NULL) {
+
+            error = "Unable to create " + type + " element " + name + " of " + parent.getName();
+            return false;
+        }
+        // Elements named from their XML content are not named at creation
+        if (child->getName() != name) {
+
+            child->setName(name);
+        }
+        parent.addChild(child);
+        child->setDescription(reader.readString());
+        bool ok = child->propertiesFromImage(reader, componentLibrary, error);
+
+        if (!ok ||
+            !childrenFromImage(*child, reader, library, componentLibrary, error)) {
+
+            return false;
+        }
+    }
+    if (reader.hasFailed()) {
+
+        error = "Truncated structure image";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class CElement;
+class CElementLibrary;
+class CComponentLibrary;
+class CSystemClass;
+class CStartupProfile;
+class CParameterMgrModel;
+class CImageWriter;
+class CImageReader;
+
+/** Precompiled binary image of the system class structure
+ *
+ * The image holds the built structure: the subsystems with their mapping, and the component
+ * types and instance definitions of each subsystem with the properties read from their XML.
+ * Loading it recreates the subsystems and their types and instantiates them, without libxml2;
+ * the mapping is then done as for a structure read from XML.
+ *
+ * The image records the stamp (device, inode, size and modification time) of each file it was
+ * built from and is only loaded if none of them changed; any mismatch or corruption makes the
+ * load fail so that the caller can fall back to XML. The files are not read to check them.
+ */
+class CStructureImage
+{
+public:
+    /** Write the image of a structure
+     *
+     * @param[in] imagePath the path of the image file to write
+     * @param[in] sourceUris the URIs of the files the structure was read from, the top level
+     *                       structure file first
+     * @param[in] systemClass the structure, as read from XML
+     * @param[in] structureHash the hash of the instantiated structure, restored on load
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    static bool save(const std::string &imagePath, const std::vector<std::string> &sourceUris,
+                     const CSystemClass &systemClass, uint64_t structureHash,
+                     std::string &error);
+
+    /** Load a structure from an image
+     *
+     * On failure, the system class may hold part of the structure and has to be cleaned.
+     *
+     * @param[in] imagePath the path of the image file to read
+     * @param[in] structureUri the URI of the top level structure file the image must have been
+     *                         built from
+     * @param[in,out] systemClass the system class the subsystems are added to
+     * @param[in,out] model the model the type elements are created from and shared in
+     * @param[in] profile the startup profile the loading of each subsystem is added to, if any
+     * @param[out] structureHash the hash of the instantiated structure, as given on save
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    static bool load(const std::string &imagePath, const std::string &structureUri,
+                     CSystemClass &systemClass, CParameterMgrModel &model,
+                     CStartupProfile *profile, uint64_t &structureHash, std::string &error);
+
+    /** Serialize the children of an element: their number, then for each of them its builder
+     * type, name, description, properties (see CElement::propertiesToImage) and children
+     */
+    static void childrenToImage(const CElement &parent, CImageWriter &writer);
+
+    /** Restore the children written by childrenToImage
+     *
+     * @param[in,out] parent the element the children are added to
+     * @param[in,out] reader the structure image reader
+     * @param[in] library the library the children are created from
+     * @param[in] componentLibrary the component types referred to by name
+     * @param[out] error human readable error
+     * @return true on success, false otherwise
+     */
+    static bool childrenFromImage(CElement &parent, CImageReader &reader,
+                                  const CElementLibrary &library,
+                                  const CComponentLibrary &componentLibrary, std::string &error);
+
+private:
+    static const char gMagic[8];
+    static const uint32_t gVersion;
+};
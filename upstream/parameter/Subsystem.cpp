@@ -35,17 +35,28 @@
 #include "ConfigurationAccessContext.h"
 #include "SubsystemObjectCreator.h"
 #include "MappingData.h"
+#include "StartupProfile.h"
+#include "StructureImage.h"
+#include "ImageFile.h"
+#include "ElementLibrary.h"
+#include "ParameterMgrModel.h"
 #include <assert.h>
 #include <sstream>
 
 #define base CConfigurableElement
 
+// Order matters: the instance definition refers to the component library types
+struct CSubsystem::STypes
+{
+    CComponentLibrary componentLibrary;
+    CInstanceDefinition instanceDefinition;
+};
+
 using std::string;
 using std::list;
 
 CSubsystem::CSubsystem(const string &strName, core::log::Logger &logger)
-    : base(strName), _pComponentLibrary(new CComponentLibrary),
-      _pInstanceDefinition(new CInstanceDefinition), _logger(logger)
+    : base(strName), _logger(logger)
 {
     // Note: A subsystem contains instance components
     // InstanceDefintion and ComponentLibrary objects are then not chosen to be children
@@ -67,10 +78,6 @@ CSubsystem::~CSubsystem()
         delete subsystemObjectCreator;
     }
 
-    // Order matters!
-    delete _pInstanceDefinition;
-    delete _pComponentLibrary;
-
     delete _pMappingData;
 }
 
@@ -85,6 +92,12 @@ bool CSubsystem::isAlive() const
     return true;
 }
 
+// Concurrent synchronization and mapping
+bool CSubsystem::isThreadSafe() const
+{
+    return false;
+}
+
 // Resynchronization after subsystem restart needed
 bool CSubsystem::needResync(bool /*bClear*/)
 {
@@ -100,14 +113,16 @@ bool CSubsystem::structureFromXml(const CXmlElement &xmlElement,
     xmlElement.getAttribute(gDescriptionPropertyName, description);
     setDescription(description);
 
+    xmlElement.getAttribute("Type", _type);
+
     // Context
     CXmlParameterSerializingContext &parameterBuildContext =
         static_cast<CXmlParameterSerializingContext &>(serializingContext);
 
-    // Install temporary component library for further component creation
-    parameterBuildContext.setComponentLibrary(_pComponentLibrary);
-
-    CXmlElement childElement;
+    // Profile the structure loading of each subsystem, and its mapping unless deferred to
+    // CSystemClass::mapSubsystems, which profiles it as a sub-phase of its own
+    CStartupProfile::CScope profileScope(parameterBuildContext.getStartupProfile(),
+                                         "Subsystem " + getName());
 
     // Manage mapping attribute
     string rawMapping;
@@ -124,23 +139,47 @@ bool CSubsystem::structureFromXml(const CXmlElement &xmlElement,
         }
     }
 
-    // XML populate ComponentLibrary
-    xmlElement.getChildElement("ComponentLibrary", childElement);
+    // Types only depend on the subsystem XML: reuse those of another framework if possible
+    assert(parameterBuildContext.getModel() != nullptr);
+    CParameterMgrModel &model = *parameterBuildContext.getModel();
+    _typesKey = xmlElement.hash();
+    _types = findTypes(model, _typesKey);
 
-    if (!_pComponentLibrary->fromXml(childElement, serializingContext)) {
+    if (_types == nullptr) {
 
-        return false;
-    }
+        std::shared_ptr<STypes> types = makeTypes(model, _typesKey);
 
-    // XML populate InstanceDefintion
-    xmlElement.getChildElement("InstanceDefintion", childElement);
-    if (!_pInstanceDefinition->fromXml(childElement, serializingContext)) {
+        // Install temporary component library for further component creation
+        parameterBuildContext.setComponentLibrary(&types->componentLibrary);
 
-        return false;
+        CXmlElement childElement;
+
+        // XML populate ComponentLibrary
+        xmlElement.getChildElement("ComponentLibrary", childElement);
+
+        if (!types->componentLibrary.fromXml(childElement, serializingContext)) {
+
+            return false;
+        }
+
+        // XML populate InstanceDefintion
+        xmlElement.getChildElement("InstanceDefintion", childElement);
+        if (!types->instanceDefinition.fromXml(childElement, serializingContext)) {
+
+            return false;
+        }
+        _types = types;
+        model.shareSubsystemTypes(_typesKey, _types);
     }
 
     // Create components
-    _pInstanceDefinition->createInstances(this);
+    assert(parameterBuildContext.getInstanceArena() != nullptr);
+    _types->instanceDefinition.createInstances(this, *parameterBuildContext.getInstanceArena());
+
+    if (parameterBuildContext.getDeferredMapping()) {
+
+        return true;
+    }
 
     // Execute mapping to create subsystem mapping entities
     string strError;
@@ -154,6 +193,101 @@ bool CSubsystem::structureFromXml(const CXmlElement &xmlElement,
     return true;
 }
 
+void CSubsystem::structureToImage(CImageWriter &writer) const
+{
+    writer.writeString(getDescription());
+
+    writer.writeUInt8(_pMappingData != nullptr);
+    if (_pMappingData != nullptr) {
+
+        _pMappingData->toImage(writer);
+    }
+
+    // Types, sized so that they can be skipped when shared
+    CImageWriter types;
+    CStructureImage::childrenToImage(_types->componentLibrary, types);
+    CStructureImage::childrenToImage(_types->instanceDefinition, types);
+
+    writer.writeUInt64(_typesKey);
+    writer.writeUInt64(types.getData().size());
+    writer.writeBytes(types.getData().data(), types.getData().size());
+}
+
+bool CSubsystem::structureFromImage(CImageReader &reader, CParameterMgrModel &model,
+                                    utility::Arena &arena, string &error)
+{
+    setDescription(reader.readString());
+
+    if (reader.readUInt8() != 0) {
+
+        _pMappingData = new CMappingData;
+        if (!_pMappingData->fromImage(reader, error)) {
+
+            return false;
+        }
+    }
+
+    // Types only depend on the subsystem XML: reuse those of another framework if possible
+    _typesKey = reader.readUInt64();
+    size_t typesSize = static_cast<size_t>(reader.readUInt64());
+    _types = findTypes(model, _typesKey);
+
+    if (_types != nullptr) {
+
+        reader.readBytes(typesSize);
+    } else {
+
+        std::shared_ptr<STypes> types = makeTypes(model, _typesKey);
+        const CElementLibrary &library = *model.getTypeLibrary();
+
+        if (!CStructureImage::childrenFromImage(types->componentLibrary, reader, library,
+                                                types->componentLibrary, error) ||
+            !CStructureImage::childrenFromImage(types->instanceDefinition, reader, library,
+                                                types->componentLibrary, error)) {
+
+            return false;
+        }
+        _types = types;
+        model.shareSubsystemTypes(_typesKey, _types);
+    }
+    if (reader.hasFailed()) {
+
+        error = "Truncated structure of subsystem " + getName();
+        return false;
+    }
+
+    // Create components
+    _types->instanceDefinition.createInstances(this, arena);
+
+    return true;
+}
+
+const string &CSubsystem::getType() const
+{
+    return _type;
+}
+
+std::shared_ptr<const CSubsystem::STypes> CSubsystem::findTypes(const CParameterMgrModel &model,
+                                                                uint64_t key)
+{
+    return std::static_pointer_cast<const STypes>(model.findSubsystemTypes(key));
+}
+
+std::shared_ptr<CSubsystem::STypes> CSubsystem::makeTypes(CParameterMgrModel &model, uint64_t key)
+{
+    // The model may be released first, along with its index of the types
+    std::weak_ptr<CParameterMgrModel> weakModel = model.shared_from_this();
+
+    return std::shared_ptr<STypes>(new STypes, [weakModel, key](STypes *released) {
+        std::shared_ptr<CParameterMgrModel> model = weakModel.lock();
+        if (model != nullptr) {
+
+            model->forgetSubsystemTypes(key);
+        }
+        delete released;
+    });
+}
+
 bool CSubsystem::mapSubsystemElements(string &strError)
 {
     // Default mapping context
@@ -37,6 +37,7 @@
 #include <log/Logger.h>
 
 #include <list>
+#include <memory>
 #include <stack>
 #include <string>
 #include <vector>
@@ -47,6 +48,13 @@ class CSubsystemObject;
 class CSubsystemObjectCreator;
 class CInstanceConfigurableElement;
 class CMappingData;
+class CParameterMgrModel;
+class CImageWriter;
+class CImageReader;
+namespace utility
+{
+class Arena;
+}
 
 class PARAMETER_EXPORT CSubsystem : public CConfigurableElement, private IMapper
 {
@@ -66,12 +74,55 @@ public:
     virtual bool structureFromXml(const CXmlElement &xmlElement,
                                   CXmlSerializingContext &serializingContext);
 
+    /** Serialize what structureFromXml read to a structure image
+     *
+     * @param[in,out] writer the structure image writer
+     */
+    void structureToImage(CImageWriter &writer) const;
+
+    /** Restore what structureToImage wrote and create the components, as structureFromXml does
+     *
+     * The mapping is left to mapSubsystemElements.
+     *
+     * @param[in,out] reader the structure image reader
+     * @param[in,out] model the model the type elements are created from, and whose types are
+     *                    reused if parsed from the same XML
+     * @param[in] arena the arena the instances are allocated from
+     * @param[out] error the reason of the failure
+     * @return true on success, false otherwise
+     */
+    bool structureFromImage(CImageReader &reader, CParameterMgrModel &model,
+                            utility::Arena &arena, std::string &error);
+
+    /** @return the Type attribute of the subsystem, which selects its builder */
+    const std::string &getType() const;
+
     // Susbsystem sanity
     virtual bool isAlive() const;
 
     // Resynchronization after subsystem restart needed
     virtual bool needResync(bool bClear);
 
+    /** Can the subsystem be synchronized and mapped concurrently with other subsystems ?
+     *
+     * Subsystems that can not, the default, are synchronized and mapped one after the other.
+     * Subsystems that can must also tolerate logging from several threads at once.
+     *
+     * @return true if the subsystem may be synchronized or mapped from another thread while
+     *         other subsystems are being synchronized or mapped
+     */
+    virtual bool isThreadSafe() const;
+
+    /** Create the subsystem objects of the instantiated elements.
+     *
+     * Done while loading the structure, unless deferred by the serializing context.
+     *
+     * @param[out] strError the error if the mapping failed
+     *
+     * @return true on success, false otherwise
+     */
+    bool mapSubsystemElements(std::string &strError);
+
     // from CElement
     virtual std::string getKind() const;
 
@@ -113,9 +164,6 @@ private:
     // Belonging subsystem
     virtual const CSubsystem *getBelongingSubsystem() const;
 
-    // Mapping execution
-    bool mapSubsystemElements(std::string &strError);
-
     /**
      * Handle a configurable element mapping.
      *
@@ -242,13 +290,31 @@ private:
     // Mapping Context stack
     std::stack<CMappingContext> _contextStack;
 
-    // Subelements
-    CComponentLibrary *_pComponentLibrary;
-    CInstanceDefinition *_pInstanceDefinition;
+    /** Component library and instance definition, immutable once parsed */
+    struct STypes;
+
+    /** @return the types another subsystem of the model parsed from the same XML, if still
+     *          alive, NULL otherwise
+     *
+     * @param[in] model the model the types are shared in
+     * @param[in] key the hash of the subsystem XML, see CXmlElement::hash
+     */
+    static std::shared_ptr<const STypes> findTypes(const CParameterMgrModel &model, uint64_t key);
+    /** @return empty types, forgotten by the model once released */
+    static std::shared_ptr<STypes> makeTypes(CParameterMgrModel &model, uint64_t key);
+
+    /** Hash of the subsystem XML, which the types are shared by */
+    uint64_t _typesKey{0};
+
+    // Subelements, shared by the subsystems of the model described by the same XML
+    std::shared_ptr<const STypes> _types;
 
     //! Contains the mapping info at Subsystem level
     CMappingData *_pMappingData{nullptr};
 
+    /** Type of the subsystem, as in its XML */
+    std::string _type;
+
     /** Logger which has to be provided to subsystem objects */
     core::log::Logger &_logger;
 };
@@ -137,6 +137,11 @@ bool CSubsystemObject::sync(CParameterBlackboard &parameterBlackboard, bool bBac
         }
         return false;
     }
+    if (bBack) {
+
+        // Back synchronized values may have been written through the blackboard location
+        parameterBlackboard.markModified(getOffset(), _dataSize);
+    }
 
     return true;
 }
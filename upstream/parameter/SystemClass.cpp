@@ -37,6 +37,10 @@
 #include "DynamicLibrary.hpp"
 #include "Utility.h"
 #include "Memory.hpp"
+#include "ParallelFor.hpp"
+#include "PathNavigator.h"
+#include "StartupProfile.h"
+#include <vector>
 
 #define base CConfigurableElement
 
@@ -220,6 +224,56 @@ bool CSystemClass::loadPlugins(list<string> &lstrPluginFiles, core::Results &err
     return bAtLeastOneSubsystemPluginSuccessfullyLoaded;
 }
 
+utility::Arena &CSystemClass::getInstanceArena()
+{
+    return _instanceArena;
+}
+
+void CSystemClass::clean()
+{
+    {
+        std::lock_guard<std::mutex> lock(_elementIndexMutex);
+        _elementIndex.clear();
+    }
+    // Instances are destroyed with their subsystem, only then can their memory be freed
+    base::clean();
+    _instanceArena.clear();
+}
+
+const CElement *CSystemClass::findElement(const string &path) const
+{
+    return const_cast<CSystemClass *>(this)->findElement(path);
+}
+
+CElement *CSystemClass::findElement(const string &path)
+{
+    {
+        std::lock_guard<std::mutex> lock(_elementIndexMutex);
+
+        auto it = _elementIndex.find(path);
+        if (it != _elementIndex.end()) {
+
+            return it->second;
+        }
+    }
+    CPathNavigator pathNavigator(path);
+    string *pStrRootName = pathNavigator.next();
+
+    if (!pathNavigator.isPathValid() || pStrRootName == NULL || *pStrRootName != getName()) {
+
+        return NULL;
+    }
+    CElement *pElement = findDescendant(pathNavigator);
+
+    // Only found elements are indexed, the index does not grow with lookup errors
+    if (pElement != NULL) {
+
+        std::lock_guard<std::mutex> lock(_elementIndexMutex);
+        _elementIndex.emplace(path, pElement);
+    }
+    return pElement;
+}
+
 const CSubsystemLibrary *CSystemClass::getSubsystemLibrary() const
 {
     return _pSubsystemLibrary;
@@ -244,6 +298,53 @@ void CSystemClass::checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Resul
     }
 }
 
+void CSystemClass::forEachSubsystem(size_t concurrency,
+                                    const std::function<void(size_t, CSubsystem &)> &task)
+{
+    // Each thread-safe subsystem is a lane, the other subsystems all share the first one
+    std::vector<std::vector<size_t>> lanes(1);
+    size_t uiNbChildren = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        if (static_cast<const CSubsystem *>(getChild(uiChild))->isThreadSafe()) {
+
+            lanes.push_back({uiChild});
+        } else {
+
+            lanes.front().push_back(uiChild);
+        }
+    }
+
+    utility::parallelFor(lanes.size(), concurrency, [&](size_t lane) {
+        for (size_t uiChild : lanes[lane]) {
+
+            task(uiChild, *static_cast<CSubsystem *>(getChild(uiChild)));
+        }
+    });
+}
+
+bool CSystemClass::mapSubsystems(size_t concurrency, CStartupProfile *profile, string &strError)
+{
+    std::vector<string> mappingErrors(getNbChildren());
+    std::vector<char> mapped(getNbChildren());
+
+    forEachSubsystem(concurrency, [&](size_t uiChild, CSubsystem &subsystem) {
+        CStartupProfile::CScope profileScope(profile, "Subsystem " + subsystem.getName(), true);
+        mapped[uiChild] = subsystem.mapSubsystemElements(mappingErrors[uiChild]);
+    });
+
+    for (size_t uiChild = 0; uiChild < mapped.size(); uiChild++) {
+
+        if (!mapped[uiChild]) {
+
+            strError = mappingErrors[uiChild];
+            return false;
+        }
+    }
+    return true;
+}
+
 void CSystemClass::cleanSubsystemsNeedToResync()
 {
     size_t uiNbChildren = getNbChildren();
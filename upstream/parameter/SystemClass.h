@@ -32,12 +32,18 @@
 #include "ConfigurableElement.h"
 #include "SubsystemPlugins.h"
 #include "Results.h"
+#include "Arena.h"
 #include <log/Logger.h>
+#include <functional>
 #include <list>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
+class CSubsystem;
 class CSubsystemLibrary;
+class CStartupProfile;
 class DynamicLibrary;
 
 class CSystemClass final : public CConfigurableElement
@@ -80,6 +86,46 @@ public:
       */
     void cleanSubsystemsNeedToResync();
 
+    /** Run a task on each subsystem, from several threads if allowed.
+     *
+     * Thread-safe subsystems (see CSubsystem::isThreadSafe) are handled concurrently,
+     * the other ones one after the other.
+     *
+     * @param[in] concurrency the maximum number of threads running the task, 1 for none
+     * @param[in] task called once per subsystem with its child index
+     */
+    void forEachSubsystem(size_t concurrency,
+                          const std::function<void(size_t, CSubsystem &)> &task);
+
+    /** Map the elements of every subsystem whose mapping was deferred at structure loading.
+     *
+     * @param[in] concurrency the maximum number of subsystems mapped at once
+     * @param[in] profile the profile to record the mapping of each subsystem to, none if NULL
+     * @param[out] strError the error of the first subsystem failing to map, in children order
+     *
+     * @return true if all subsystems were mapped, false otherwise
+     */
+    bool mapSubsystems(size_t concurrency, CStartupProfile *profile, std::string &strError);
+
+    /** @return the arena the instances of all subsystems are allocated in, see
+     * CTypeElement::instantiate
+     */
+    utility::Arena &getInstanceArena();
+
+    /** Remove the subsystems and free their instances at once */
+    void clean() override;
+
+    /** Find an element from its full path, starting with the system class name
+     *
+     * The elements found are indexed by path: finding them again costs a hash lookup instead
+     * of a walk down the tree. The index is cleared with the subsystems.
+     *
+     * @param[in] path the element path, array items excluded
+     * @return the element, NULL if not found
+     */
+    const CElement *findElement(const std::string &path) const;
+    CElement *findElement(const std::string &path);
+
     // base
     virtual std::string getKind() const;
 
@@ -103,6 +149,8 @@ private:
                                            const CSubsystemPlugins *pSubsystemPlugins);
 
     /** Load subsystem plugin shared libraries.
+     *
+     * Libraries are opened concurrently, then filled into the subsystem library in list order.
      *
      * @param[in,out] lstrPluginFiles is the path list of the plugins shared libraries to load.
      *                Successfully loaded plugins are removed from the list.
@@ -119,6 +167,13 @@ private:
     std::list<std::unique_ptr<DynamicLibrary>>
         _subsystemLibraryHandleList; /**< Contains the list of all open plugin libs. */
 
+    /** Memory of the subsystem instance trees, freed when the subsystems are removed */
+    utility::Arena _instanceArena;
+
+    /** Elements already found by path, guarded by _elementIndexMutex */
+    mutable std::unordered_map<std::string, CElement *> _elementIndex;
+    mutable std::mutex _elementIndexMutex;
+
     /** Application Logger we need to provide to plugins */
     core::log::Logger &_logger;
 
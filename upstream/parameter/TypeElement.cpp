@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "TypeElement.h"
+#include "ImageFile.h"
 #include "MappingData.h"
 #include "Tokenizer.h"
 #include "InstanceConfigurableElement.h"
@@ -85,7 +86,7 @@ void CTypeElement::showProperties(std::string &strResult) const
     // which have a common base Element)
 }
 
-void CTypeElement::populate(CElement *pElement) const
+void CTypeElement::populate(CElement *pElement, utility::Arena &arena) const
 {
     // Populate children
     size_t uiChild;
@@ -97,7 +98,7 @@ void CTypeElement::populate(CElement *pElement) const
             static_cast<const CTypeElement *>(getChild(uiChild));
 
         CInstanceConfigurableElement *pInstanceConfigurableChildElement =
-            pChildTypeElement->instantiate();
+            pChildTypeElement->instantiate(arena);
 
         // Affiliate
         pElement->addChild(pInstanceConfigurableChildElement);
@@ -124,12 +125,42 @@ bool CTypeElement::fromXml(const CXmlElement &xmlElement,
     return base::fromXml(xmlElement, serializingContext);
 }
 
-CInstanceConfigurableElement *CTypeElement::instantiate() const
+// Structure image
+void CTypeElement::propertiesToImage(CImageWriter &writer) const
 {
-    CInstanceConfigurableElement *pInstanceConfigurableElement = doInstantiate();
+    base::propertiesToImage(writer);
+    writer.writeUInt64(_arrayLength);
+
+    writer.writeUInt8(_pMappingData != nullptr);
+    if (_pMappingData != nullptr) {
+
+        _pMappingData->toImage(writer);
+    }
+}
+
+bool CTypeElement::propertiesFromImage(CImageReader &reader,
+                                       const CComponentLibrary &componentLibrary,
+                                       std::string &error)
+{
+    if (!base::propertiesFromImage(reader, componentLibrary, error)) {
+
+        return false;
+    }
+    _arrayLength = static_cast<size_t>(reader.readUInt64());
+
+    if (reader.readUInt8() != 0 && !getMappingData()->fromImage(reader, error)) {
+
+        return false;
+    }
+    return true;
+}
+
+CInstanceConfigurableElement *CTypeElement::instantiate(utility::Arena &arena) const
+{
+    CInstanceConfigurableElement *pInstanceConfigurableElement = doInstantiate(arena);
 
     // Populate
-    populate(pInstanceConfigurableElement);
+    populate(pInstanceConfigurableElement, arena);
 
     return pInstanceConfigurableElement;
 }
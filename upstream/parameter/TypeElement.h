@@ -36,6 +36,10 @@
 
 class CMappingData;
 class CInstanceConfigurableElement;
+namespace utility
+{
+class Arena;
+} // namespace utility
 
 class PARAMETER_EXPORT CTypeElement : public CElement
 {
@@ -43,8 +47,12 @@ public:
     CTypeElement(const std::string &strName = "");
     virtual ~CTypeElement();
 
-    // Instantiation
-    CInstanceConfigurableElement *instantiate() const;
+    /** Instantiate the type, depth first.
+     *
+     * @param[in] arena the arena the instance tree is allocated in, see CSystemClass
+     * @return the instance, whose descendants are in memory in their traversal order
+     */
+    CInstanceConfigurableElement *instantiate(utility::Arena &arena) const;
 
     // Mapping info
     virtual bool getMappingData(const std::string &strKey, const std::string *&pStrValue) const;
@@ -63,6 +71,11 @@ public:
     // From IXmlSink
     virtual bool fromXml(const CXmlElement &xmlElement, CXmlSerializingContext &serializingContext);
 
+    // Structure image
+    void propertiesToImage(CImageWriter &writer) const override;
+    bool propertiesFromImage(CImageReader &reader, const CComponentLibrary &componentLibrary,
+                             std::string &error) override;
+
     // From IXmlSource
     virtual void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const;
 
@@ -83,7 +96,7 @@ public:
 
 protected:
     // Object creation
-    virtual void populate(CElement *pElement) const;
+    virtual void populate(CElement *pElement, utility::Arena &arena) const;
     /** @Returns the mapping associated to the current type and its predecessor
      *
      * The meaning of predecessor depends on the TypeElement type: e.g. for a
@@ -100,7 +113,7 @@ private:
     CTypeElement(const CTypeElement &);
     CTypeElement &operator=(const CTypeElement &);
     // Actual instance creation
-    virtual CInstanceConfigurableElement *doInstantiate() const = 0;
+    virtual CInstanceConfigurableElement *doInstantiate(utility::Arena &arena) const = 0;
 
     // Mapping data creation and access
     CMappingData *getMappingData();
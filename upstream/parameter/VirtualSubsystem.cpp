@@ -48,6 +48,12 @@ CVirtualSubsystem::~CVirtualSubsystem()
     delete _pVirtualSyncer;
 }
 
+// Concurrent synchronization and mapping
+bool CVirtualSubsystem::isThreadSafe() const
+{
+    return true;
+}
+
 // Syncer
 ISyncer *CVirtualSubsystem::getSyncer() const
 {
@@ -45,6 +45,9 @@ public:
     CVirtualSubsystem(const std::string &strName, core::log::Logger &logger);
     virtual ~CVirtualSubsystem();
 
+    // Virtual subsystems only write default values to their own blackboard area and map nothing
+    bool isThreadSafe() const override;
+
 protected:
     // Syncer
     virtual ISyncer *getSyncer() const;
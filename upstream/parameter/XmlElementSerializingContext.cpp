@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "XmlElementSerializingContext.h"
+#include "XmlDocSource.h"
 
 #define base CXmlSerializingContext
 
@@ -56,3 +57,29 @@ const string &CXmlElementSerializingContext::getXmlUri() const
 {
     return _xmlUri;
 }
+
+// Included documents prefetching
+void CXmlElementSerializingContext::setDocPrefetcher(CXmlDocPrefetcher *docPrefetcher)
+{
+    _pDocPrefetcher = docPrefetcher;
+}
+
+CXmlDocPrefetcher *CXmlElementSerializingContext::getDocPrefetcher() const
+{
+    return _pDocPrefetcher;
+}
+
+// Source files recording
+void CXmlElementSerializingContext::setSourceUris(std::vector<string> *sourceUris)
+{
+    _pSourceUris = sourceUris;
+}
+
+void CXmlElementSerializingContext::recordSource(const string &uri, _xmlDoc *doc)
+{
+    if (_pSourceUris != nullptr) {
+
+        _pSourceUris->push_back(uri);
+        CXmlDocSource::listXIncludedUris(doc, *_pSourceUris);
+    }
+}
@@ -32,8 +32,11 @@
 #include "XmlSerializingContext.h"
 
 #include <string>
+#include <vector>
 
 class CElementLibrary;
+class CXmlDocPrefetcher;
+struct _xmlDoc;
 
 class CXmlElementSerializingContext : public CXmlSerializingContext
 {
@@ -49,7 +52,18 @@ public:
     // Xml URI
     const std::string &getXmlUri() const;
 
+    // Prefetcher of the included documents, if any
+    void setDocPrefetcher(CXmlDocPrefetcher *docPrefetcher);
+    CXmlDocPrefetcher *getDocPrefetcher() const;
+
+    // List of the files read, to which the processed documents are recorded, if any
+    void setSourceUris(std::vector<std::string> *sourceUris);
+    // Record a processed document and the files it XIncludes
+    void recordSource(const std::string &uri, _xmlDoc *doc);
+
 private:
     const CElementLibrary *_pElementLibrary{nullptr};
     std::string _xmlUri;
+    CXmlDocPrefetcher *_pDocPrefetcher{nullptr};
+    std::vector<std::string> *_pSourceUris{nullptr};
 };
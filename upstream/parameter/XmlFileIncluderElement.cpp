@@ -29,6 +29,7 @@
  */
 #include "XmlFileIncluderElement.h"
 #include "XmlDocSource.h"
+#include "XmlDocPrefetcher.h"
 #include "XmlMemoryDocSink.h"
 #include "XmlElementSerializingContext.h"
 #include "ElementLibrary.h"
@@ -61,9 +62,20 @@ bool CXmlFileIncluderElement::fromXml(const CXmlElement &xmlElement,
     // Instantiate parser
     std::string strIncludedElementType = getIncludedElementType();
     {
-        _xmlDoc *doc = CXmlDocSource::mkXmlDoc(strPath, true, true, elementSerializingContext);
+        // Use the prefetched document, if read successfully
+        CXmlDocPrefetcher *docPrefetcher = elementSerializingContext.getDocPrefetcher();
+        bool bValidated = false;
+        _xmlDoc *doc =
+            docPrefetcher != nullptr ? docPrefetcher->take(strPath, bValidated) : nullptr;
 
-        CXmlDocSource docSource(doc, _bValidateSchemasOnStart, strIncludedElementType);
+        if (doc == nullptr) {
+
+            doc = CXmlDocSource::mkXmlDoc(strPath, true, true, elementSerializingContext);
+        }
+
+        // A document found valid when prefetched is not validated again
+        CXmlDocSource docSource(doc, _bValidateSchemasOnStart && !bValidated,
+                                strIncludedElementType);
 
         if (not _schemaBaseUri.empty()) {
             docSource.setSchemaBaseUri(_schemaBaseUri);
@@ -104,6 +116,8 @@ bool CXmlFileIncluderElement::fromXml(const CXmlElement &xmlElement,
 
             return false;
         }
+
+        elementSerializingContext.recordSource(strPath, docSource.getDoc());
     }
     // Detach from parent
     getParent()->removeChild(this);
@@ -50,3 +50,47 @@ const CComponentLibrary *CXmlParameterSerializingContext::getComponentLibrary()
 {
     return _pComponentLibrary;
 }
+
+// Startup profiling
+void CXmlParameterSerializingContext::setStartupProfile(CStartupProfile *pStartupProfile)
+{
+    _pStartupProfile = pStartupProfile;
+}
+
+CStartupProfile *CXmlParameterSerializingContext::getStartupProfile() const
+{
+    return _pStartupProfile;
+}
+
+// Instance arena
+void CXmlParameterSerializingContext::setInstanceArena(utility::Arena *pInstanceArena)
+{
+    _pInstanceArena = pInstanceArena;
+}
+
+utility::Arena *CXmlParameterSerializingContext::getInstanceArena() const
+{
+    return _pInstanceArena;
+}
+
+// Model
+void CXmlParameterSerializingContext::setModel(CParameterMgrModel *pModel)
+{
+    _pModel = pModel;
+}
+
+CParameterMgrModel *CXmlParameterSerializingContext::getModel() const
+{
+    return _pModel;
+}
+
+// Subsystem mapping
+void CXmlParameterSerializingContext::setDeferredMapping(bool bDeferredMapping)
+{
+    _bDeferredMapping = bDeferredMapping;
+}
+
+bool CXmlParameterSerializingContext::getDeferredMapping() const
+{
+    return _bDeferredMapping;
+}
@@ -35,6 +35,12 @@
 #include <string>
 
 class CComponentLibrary;
+class CStartupProfile;
+class CParameterMgrModel;
+namespace utility
+{
+class Arena;
+} // namespace utility
 
 class CXmlParameterSerializingContext : public CXmlElementSerializingContext
 {
@@ -47,8 +53,28 @@ public:
 
     CParameterAccessContext &getAccessContext() const { return mAccessContext; }
 
+    // Profile of the start the structure is loaded for, if any
+    void setStartupProfile(CStartupProfile *pStartupProfile);
+    CStartupProfile *getStartupProfile() const;
+
+    // Arena instances are allocated in, see CSystemClass::getInstanceArena
+    void setInstanceArena(utility::Arena *pInstanceArena);
+    utility::Arena *getInstanceArena() const;
+
+    // Model subsystems share their types in
+    void setModel(CParameterMgrModel *pModel);
+    CParameterMgrModel *getModel() const;
+
+    // Subsystems leave the mapping of their elements to the caller, see CSystemClass::mapSubsystems
+    void setDeferredMapping(bool bDeferredMapping);
+    bool getDeferredMapping() const;
+
 private:
     const CComponentLibrary *_pComponentLibrary{nullptr};
+    CStartupProfile *_pStartupProfile{nullptr};
+    utility::Arena *_pInstanceArena{nullptr};
+    CParameterMgrModel *_pModel{nullptr};
+    bool _bDeferredMapping{false};
 
     CParameterAccessContext &mAccessContext;
 };
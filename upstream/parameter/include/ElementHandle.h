@@ -32,6 +32,7 @@
 #include "parameter_export.h"
 
 #include <stdint.h>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -102,6 +103,37 @@ public:
      */
     bool getMappingData(const std::string &strKey, std::string &strValue) const;
 
+    /** Callback notified of the parameters changed by a configuration application.
+     *
+     * @param[in] changedParameters the paths of the changed parameters under the subscribed
+     *                              element, in tree order.
+     */
+    using ChangeCallback = std::function<void(const std::vector<std::string> &changedParameters)>;
+
+    /** Identifier of a change subscription, 0 is never a valid one. */
+    using SubscriptionId = uint32_t;
+
+    /** Subscribe to the changes of the element parameters.
+     *
+     * Changes are detected by comparing the parameter values before and after each
+     * configuration application, thus restoring a configuration holding the current values is
+     * not notified. The callback is called at most once per application, from the thread
+     * applying the configurations, after the parameters have been unlocked: it may access them.
+     *
+     * The subscription outlives the handle.
+     *
+     * @param[in] callback the callback to notify
+     * @return the subscription identifier, to unsubscribe
+     */
+    SubscriptionId subscribeToChanges(ChangeCallback callback);
+
+    /** Cancel a change subscription.
+     *
+     * @param[in] subscriptionId the identifier returned when subscribing,
+     *                           unknown ones are ignored
+     */
+    void unsubscribeFromChanges(SubscriptionId subscriptionId);
+
     /** Gets element structure description as XML string
      *
      * @return the output XML string
@@ -226,7 +258,8 @@ public:
 
 protected:
     ElementHandle(CConfigurableElement &element, CParameterMgr &parameterMgr);
-    friend CParameterMgr; // So that it can build the handler
+    friend CParameterMgr;        // So that it can build the handler
+    friend class ParameterBatch; // So that it can access the parameters at once
 
 private:
     template <class T>
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+
+#include "ElementHandle.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/** Forward declaration of private classes.
+ * Client should not use those class.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterAccessContext;
+class CBaseParameter;
+class CParameterBlackboard;
+class ISyncer;
+/** @} */
+
+/** Batch of parameter accesses, applied at once.
+ *
+ * Accessing parameters one by one through ElementHandle locks the parameters and synchronizes
+ * the hardware for each access. A batch applies all its accesses under a single lock, then
+ * synchronizes each syncer concerned by its sets once.
+ *
+ * Accesses are validated as by ElementHandle and applied in the order they were added. If one
+ * of them fails, the parameters are restored and nothing is synchronized. If a synchronization
+ * fails, the parameters are restored and every syncer already synchronized, the failing one
+ * included, is synchronized again with the restored values; the hardware is only left
+ * partially modified if that fails as well, which the error then reports.
+ * Accesses are only recorded until the batch is applied, handles and get values must thus
+ * outlive the application.
+ * A batch reuses its storage from one application to the next, it must not be applied from
+ * several threads at once.
+ */
+class PARAMETER_EXPORT ParameterBatch
+{
+public:
+    /** Add the set of a scalar parameter.
+     * @see ElementHandle::setAsBoolean and the like
+     * @{
+     */
+    void setAsBoolean(const ElementHandle &handle, bool value);
+    void setAsInteger(const ElementHandle &handle, uint32_t value);
+    void setAsSignedInteger(const ElementHandle &handle, int32_t value);
+    void setAsDouble(const ElementHandle &handle, double value);
+    void setAsString(const ElementHandle &handle, const std::string &value);
+    /** @} */
+
+    /** Add the get of a scalar parameter, the value being read when the batch is applied.
+     * @see ElementHandle::getAsBoolean and the like
+     * @{
+     */
+    void getAsBoolean(const ElementHandle &handle, bool &value);
+    void getAsInteger(const ElementHandle &handle, uint32_t &value);
+    void getAsSignedInteger(const ElementHandle &handle, int32_t &value);
+    void getAsDouble(const ElementHandle &handle, double &value);
+    void getAsString(const ElementHandle &handle, std::string &value);
+    /** @} */
+
+    /** @return the number of accesses added since the batch creation or last clear. */
+    size_t size() const;
+
+    /** Remove all the accesses. */
+    void clear();
+
+    /** Apply the accesses.
+     *
+     * All the handles must be from the same parameter framework. As with ElementHandle, sets
+     * are silently skipped while the tuning mode is on.
+     * The batch is kept, it can be applied again.
+     *
+     * @param[out] error On failure (false returned) will contain a human
+     *                   readable description of the error.
+     *                   On success (true returned) the content is not
+     *                   specified.
+     * @return true if all the accesses and synchronizations succeeded, false otherwise,
+     *         in which case the get values are unspecified.
+     */
+    bool apply(std::string &error) const;
+
+private:
+    /** Access to a parameter, tagged with the type of its value */
+    struct Access
+    {
+        enum Type
+        {
+            EBoolean,
+            EInteger,
+            ESignedInteger,
+            EDouble,
+            EString
+        };
+
+        const ElementHandle *handle;
+        bool isSet;
+        Type type;
+        /** Value of a scalar set */
+        union
+        {
+            bool boolean;
+            uint32_t integer;
+            int32_t signedInteger;
+            double floating;
+        } value;
+        /** Value of a string set */
+        std::string string;
+        /** Value of a get, of the type given by the tag */
+        void *destination;
+    };
+
+    /** Add an access whose value is left to the caller */
+    Access &add(const ElementHandle &handle, bool isSet, Access::Type type);
+
+    /** Do an access to the blackboard of the context */
+    bool perform(const Access &access, CParameterAccessContext &context) const;
+
+    /** Put back the parameters set by the current application */
+    void restore(CParameterBlackboard &blackboard) const;
+
+    std::vector<Access> mAccesses;
+
+    /** Storage of an application, kept to spare its allocations to the next ones
+     * @{
+     */
+    mutable std::vector<ISyncer *> mSyncers;
+    /** Settings of the set parameters before the application, to restore them on failure */
+    mutable std::vector<uint8_t> mPreviousSettings;
+    mutable std::vector<const CBaseParameter *> mSetParameters;
+    /** Copy of a string set, BaseParameter::access taking a non-const value */
+    mutable std::string mStringCopy;
+    /** @} */
+};
@@ -57,6 +57,13 @@ public:
 
     CParameterMgrFullConnector(const std::string &strConfigurationFilePath);
 
+    /** Construction sharing the immutable parts of the connectors of a model
+     *
+     * @see CParameterMgrPlatformConnector::createModel
+     */
+    CParameterMgrFullConnector(const std::string &strConfigurationFilePath,
+                               std::shared_ptr<CParameterMgrModel> model);
+
     /** Create and return a command handler for this ParameterMgr instance
      *
      * The caller owns the returned pointer and is responsible for deleting it
@@ -245,6 +252,19 @@ public:
     bool exportSingleDomainXml(std::string &strXmlDest, const std::string &strDomainName,
                                bool bWithSettings, bool bToFile, std::string &strError) const;
 
+    /**
+      * Method that exports Configurable Domains and their settings to a binary settings image.
+      *
+      * The image is used at start instead of the domains XML file when the framework
+      * configuration refers to it with a SettingsImageFileLocation element.
+      *
+      * @param[in] strImagePath the path of the image file to write
+      * @param[out] strError is used as the error output
+      *
+      * @return false if any error occurs, true otherwise.
+      */
+    bool exportSettingsImage(const std::string &strImagePath, std::string &strError) const;
+
 private:
     // disallow copying because this class manages raw pointers' lifecycle
     CParameterMgrFullConnector(const CParameterMgrFullConnector &);
@@ -35,9 +35,15 @@
 #include "SelectionCriterionInterface.h"
 #include "ParameterHandle.h"
 #include "ElementHandle.h"
+#include "ParameterBatch.h"
+#include "ScalarHandle.h"
 #include "ParameterMgrLoggerForward.h"
 
+#include <memory>
+#include <string>
+
 class CParameterMgr;
+class CParameterMgrModel;
 
 class PARAMETER_EXPORT CParameterMgrPlatformConnector
 {
@@ -61,8 +67,27 @@ public:
         virtual ~ILogger() {}
     };
 
-    // Construction
+    /** Create a model to build several connectors from
+     *
+     * The connectors built from the same model share their immutable parts: the element
+     * libraries, including the builders of the configuration rules, and the component types of
+     * the subsystems described by the same XML. Each of them keeps its own instances,
+     * blackboard, criteria, rules and subsystem objects.
+     *
+     * @return the model, opaque to clients, released once its last connector is destroyed
+     */
+    static std::shared_ptr<CParameterMgrModel> createModel();
+
+    // Construction, sharing nothing with the other connectors
     CParameterMgrPlatformConnector(const std::string &strConfigurationFilePath);
+
+    /** Construction sharing the immutable parts of the connectors of a model
+     *
+     * @param[in] strConfigurationFilePath the top level configuration file
+     * @param[in] model the model, see createModel
+     */
+    CParameterMgrPlatformConnector(const std::string &strConfigurationFilePath,
+                                   std::shared_ptr<CParameterMgrModel> model);
     virtual ~CParameterMgrPlatformConnector();
 
     // Selection Criteria interface. Beware returned objects are lent, clients shall not delete
@@ -88,6 +113,21 @@ public:
     // Configuration application
     void applyConfigurations();
 
+    /** Read the settings again from the configuration files and apply what changed.
+     *
+     * Reloaded domains are matched with the current ones by name. Unchanged configurations are
+     * kept, changed rules and settings are updated in place, domains whose elements or
+     * configurations changed are replaced. Only the domains whose selected configuration or
+     * settings changed are applied again. Must be called after start.
+     *
+     * @param[out] strError On error: an human readable error message, the current settings
+     *                      being kept
+     *                      On success: undefined
+     *
+     * @return true on success, false otherwise
+     */
+    bool reloadSettings(std::string &strError);
+
     // Dynamic parameter handling
     // Returned objects are owned by clients
     // Must be cassed after successfull start
@@ -107,6 +147,26 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error) const;
 
+    /** Creates a value typed handle to a scalar parameter.
+     *
+     * The parameter location, range and syncer are resolved once, on creation, so that
+     * accessing the parameter through the handle is cheaper than through an ElementHandle.
+     * Must be called after a successful start.
+     * The returned object is owned by the client who is responsible to delete it.
+     *
+     * @tparam T the value type: uint32_t or int32_t for an integer parameter,
+     *           bool for a boolean parameter. @see ScalarHandle
+     * @param[in] path the path of the parameter.
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return a scalar handle on success
+     *         NULL on error, including when the parameter can not be accessed with the
+     *         value type
+     */
+    template <class T>
+    ScalarHandle<T> *createScalarHandle(const std::string &path, std::string &error) const;
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -187,6 +247,152 @@ public:
      */
     bool getValidateSchemasOnStart() const;
 
+    /** Should the settings of configurations not applied for a while be compressed ?
+     *
+     * Idle configurations are compressed each time configurations are applied, their settings
+     * are transparently inflated back on their next use.
+     *
+     * May be called at any time.
+     *
+     * @param[in] bCompress: If set to true, idle configuration settings are compressed.
+     *                       If set to false, no compression happens (default behaviour).
+     * @param[in] idleDelayMs: time in milliseconds after which a configuration that has not
+     *                         been applied is considered idle.
+     */
+    void setSettingsCompression(bool bCompress, uint32_t idleDelayMs);
+
+    /** Are the settings of configurations not applied for a while compressed ?
+     *
+     * @param[out] idleDelayMs time in milliseconds after which a configuration that has not
+     *                         been applied is considered idle.
+     * @return true if idle configuration settings are compressed
+     */
+    bool getSettingsCompression(uint32_t &idleDelayMs) const;
+
+    /** Should the settings loaded from a settings image only be copied out of it on first use ?
+     *
+     * Lazily loaded settings keep the settings image in memory until they are all used.
+     *
+     * @param[in] bLazy: If set to true, the settings of a configuration are copied out of the
+     *                   settings image on their first use.
+     *                   If set to false, all settings are copied on start (default behaviour).
+     * @param[in] bWarmUp: If set to true, the settings not used yet are copied by a background
+     *                     thread once started.
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setLazySettingsLoading(bool bLazy, bool bWarmUp, std::string &strError);
+
+    /** Are the settings loaded from a settings image only copied out of it on first use ?
+     *
+     * @param[out] bWarmUp true if the settings not used yet are copied in the background
+     * @return true if settings are lazily loaded
+     */
+    bool getLazySettingsLoading(bool &bWarmUp) const;
+
+    /** How many subsystems may be back synchronized concurrently on start ?
+     *
+     * Only subsystems declaring themselves thread-safe are back synchronized concurrently,
+     * the others are back synchronized one after the other. With concurrency, the logger may
+     * be called from several threads at once.
+     *
+     * @param[in] concurrency the number of back synchronization threads,
+     *                        1 for no concurrency (default behaviour)
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setBackSynchronizationConcurrency(size_t concurrency, std::string &strError);
+    size_t getBackSynchronizationConcurrency() const;
+
+    /** How many subsystems may be mapped concurrently on start ?
+     *
+     * Only subsystems declaring themselves thread-safe are mapped concurrently, the others
+     * are mapped one after the other. With concurrency, the logger may be called from several
+     * threads at once.
+     *
+     * @param[in] concurrency the number of mapping threads, 1 for no concurrency,
+     *                        the number of hardware threads by default
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setMappingConcurrency(size_t concurrency, std::string &strError);
+    size_t getMappingConcurrency() const;
+
+    /** Should the runtime state be checkpointed to a file ?
+     *
+     * The checkpoint holds the parameter values, the last applied configurations and the
+     * criterion states. A start finding a checkpoint written from the same structure and
+     * domains files restores it instead of reading the parameters from the hardware, and only
+     * applies the configurations that changed. The criteria not set before start get back
+     * their checkpointed states.
+     * Nothing tells whether the hardware kept the checkpointed values: a checkpoint outliving
+     * a hardware reset, a reboot for instance, is trusted blindly. Place it on a storage that
+     * does not survive such resets (e.g. a tmpfs) or remove it when they happen.
+     * Once the tuning mode has been turned on, the checkpoint is removed and no longer written.
+     *
+     * @param[in] path the checkpoint file, empty for no checkpoint (default behaviour)
+     * @param[in] periodMs 0 to write the checkpoint after each configuration application,
+     *                     otherwise the period at which a background thread writes it if the
+     *                     runtime state changed, parameters set between applications included
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setRuntimeCheckpoint(const std::string &path, uint32_t periodMs, std::string &strError);
+
+    /** @param[out] periodMs the period at which the checkpoint is written, 0 if after each
+     *                       configuration application
+     * @return the checkpoint file, empty if none
+     */
+    std::string getRuntimeCheckpoint(uint32_t &periodMs) const;
+
+    /** Get the timing and memory report of the start phases. Must be called after start.
+     *
+     * @return one line per phase, the subsystems being detailed under the structure phase
+     */
+    std::string getStartupProfile() const;
+
+    /** Should the startup profile be logged at the end of the start ?
+     *
+     * @param[in] bLog: If set to true, the profile is logged as one info record.
+     *                  If set to false, it is only available on request (default behaviour).
+     */
+    void setStartupProfileLogging(bool bLog);
+
+    /** Is the startup profile logged at the end of the start ?
+     *
+     * @return true if the profile is logged
+     */
+    bool getStartupProfileLogging() const;
+
+    /** Get the parameter modification epoch.
+     *
+     * The epoch is incremented by each parameter modification (configuration application,
+     * parameter set or back synchronization changing values). Must be called after start.
+     *
+     * @return the current epoch, to be given to getChangedSince.
+     */
+    uint64_t getEpoch() const;
+
+    /** List the parameters modified after an epoch.
+     *
+     * Allows to poll modifications instead of subscribing to them with
+     * ElementHandle::subscribeToChanges. Modifications are tracked by blocks of 64 bytes:
+     * a parameter sharing a block with a modified one may be listed as well.
+     * Must be called after start.
+     *
+     * @param[in] epoch an epoch returned by getEpoch.
+     * @return the paths of the parameters modified after the epoch.
+     */
+    std::vector<std::string> getChangedSince(uint64_t epoch) const;
+
 private:
     CParameterMgrPlatformConnector(const CParameterMgrPlatformConnector &);
     CParameterMgrPlatformConnector &operator=(const CParameterMgrPlatformConnector &);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+
+#include <stdint.h>
+#include <string>
+
+/** Forward declaration of private classes.
+ * Client should not use those class.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterMgr;
+class CBaseParameter;
+class ISyncer;
+/** @} */
+
+/** Handle to a scalar parameter, bound to a value type.
+ *
+ * Where ElementHandle dispatches each access through the parameter type, this handle resolves
+ * the parameter location, size, range and syncer once, when it is created. Accesses then
+ * involve neither strings nor virtual calls, apart from the synchronization itself.
+ *
+ * Supported value types are:
+ *    - uint32_t and int32_t, for integer parameters,
+ *    - bool, for boolean parameters.
+ *
+ * Values are interpreted as by the corresponding ElementHandle accessors
+ * (ie setAsInteger, setAsSignedInteger and setAsBoolean).
+ */
+template <class T>
+class PARAMETER_EXPORT ScalarHandle
+{
+public:
+    /** @return the handled parameter path in the parameter hierarchy tree. */
+    std::string getPath() const;
+
+    /** Set the parameter value and synchronize it.
+     *
+     * As with ElementHandle, the parameter must be rogue and sets are silently skipped while
+     * the tuning mode is on.
+     *
+     * @param[in] value the value to set
+     * @param[out] error On failure (false returned) will contain a human
+     *                   readable description of the error.
+     *                   On success (true returned) the content is not
+     *                   specified.
+     * @return true if the value was set, false otherwise (see error for the detail)
+     */
+    bool set(T value, std::string &error);
+
+    /** @return the parameter value. */
+    T get() const;
+
+private:
+    ScalarHandle(const CBaseParameter &parameter, CParameterMgr &parameterMgr);
+    friend class CParameterMgr; // So that it can build the handle
+
+    /** Resolve the parameter location, range and syncer.
+     *
+     * @param[out] error if the parameter can not be accessed with the value type,
+     *                   a human readable message explaining why.
+     * @return true on success, false otherwise
+     */
+    bool bind(std::string &error);
+
+    /** Check that the parameter value can be set, ie that it is rogue.
+     *
+     * The domains can only change when leaving the tuning mode or reloading the settings,
+     * the check is only done again after those.
+     */
+    bool checkRogue(std::string &error);
+
+    const CBaseParameter &mParameter;
+    CParameterMgr &mParameterMgr;
+
+    /** Parameter location in the main blackboard. */
+    size_t mOffset{0};
+    size_t mSize{0};
+
+    /** Accepted values. */
+    T mMin{};
+    T mMax{};
+
+    /** Syncer of the parameter, nullptr if it has none. */
+    ISyncer *mSyncer{nullptr};
+
+    /** Domains revision at the last rogue check, and its outcome. */
+    uint32_t mDomainsRevision{0};
+    bool mRogue{false};
+};
+
+extern template class ScalarHandle<uint32_t>;
+extern template class ScalarHandle<int32_t>;
+extern template class ScalarHandle<bool>;
+
+/** Value typed handles @{ */
+using IntegerHandle = ScalarHandle<uint32_t>;
+using SignedIntegerHandle = ScalarHandle<int32_t>;
+using BooleanHandle = ScalarHandle<bool>;
+/** @} */
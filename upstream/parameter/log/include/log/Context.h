@@ -50,13 +50,18 @@ public:
     Context(Logger &logger, const std::string &context) : mLogger(logger)
     {
         mLogger.info() << context << " {";
+
+        std::lock_guard<std::mutex> lock(mLogger.mPrologMutex);
         mLogger.mProlog += "    ";
     }
 
     /** Class Destructor */
     ~Context()
     {
-        mLogger.mProlog.resize(mLogger.mProlog.size() - 4);
+        {
+            std::lock_guard<std::mutex> lock(mLogger.mPrologMutex);
+            mLogger.mProlog.resize(mLogger.mProlog.size() - 4);
+        }
         mLogger.info() << "}";
     }
 
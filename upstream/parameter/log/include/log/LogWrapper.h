@@ -121,8 +121,8 @@ private:
     /** Wrapped logger */
     ILogger &mLogger;
 
-    /** Log Prefix */
-    const std::string &mProlog;
+    /** Log Prefix, copied as the logger's one may change in another thread */
+    const std::string mProlog;
 };
 
 /** Default information logger type */
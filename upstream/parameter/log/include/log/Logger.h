@@ -34,13 +34,17 @@
 
 #include "NonCopyable.hpp"
 
+#include <mutex>
+#include <string>
+
 namespace core
 {
 namespace log
 {
 
-/** Application logger object (Thread unsafe)
+/** Application logger object
  * Provide contextualisable logging API.
+ * Threads may log concurrently, their contexts then sharing the same indentation.
  * Streams can be used through Info and Warning objects returned by dedicated
  * methods.
  * This is the class you want to use to log in the project.
@@ -59,14 +63,22 @@ public:
      *
      * @return Info logger
      */
-    details::Info info() { return details::Info(mLogger, mProlog); }
+    details::Info info()
+    {
+        std::lock_guard<std::mutex> lock(mPrologMutex);
+        return details::Info(mLogger, mProlog);
+    }
 
     /**
      * Retrieve wrapped warning logger
      *
      * @return Warning logger
      */
-    details::Warning warning() { return details::Warning(mLogger, mProlog); }
+    details::Warning warning()
+    {
+        std::lock_guard<std::mutex> lock(mPrologMutex);
+        return details::Warning(mLogger, mProlog);
+    }
 
 private:
     /** Raw logger provided by client */
@@ -74,6 +86,9 @@ private:
 
     /** Log prolog, owns the context indentation */
     std::string mProlog;
+
+    /** Guards the prolog, contexts being opened and closed by any thread */
+    std::mutex mPrologMutex;
 };
 
 } /** log namespace */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "ElementHandle.hpp"
+
+#include <catch.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+/** Heap allocations made by the current thread while counting. */
+static thread_local bool countAllocations = false;
+static thread_local size_t allocationCount = 0;
+
+void *operator new(size_t size)
+{
+    if (countAllocations) {
+        allocationCount++;
+    }
+    // malloc(0) may return nullptr
+    void *allocation = std::malloc(size != 0 ? size : 1);
+    if (allocation == nullptr) {
+        throw std::bad_alloc();
+    }
+    return allocation;
+}
+
+void operator delete(void *allocation) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete(void *allocation, size_t /*size*/) noexcept
+{
+    std::free(allocation);
+}
+
+namespace parameterFramework
+{
+
+/** @return the number of heap allocations made by an operation. */
+template <class Operation>
+static size_t allocationsOf(Operation operation)
+{
+    allocationCount = 0;
+    countAllocations = true;
+    operation();
+    countAllocations = false;
+    return allocationCount;
+}
+
+SCENARIO("Allocation free parameter accesses", "[handler][allocation]")
+{
+    Config config;
+    config.instances = R"(<IntegerParameter Name="integer" Size="16" Max="1000"/>
+                          <IntegerParameter Name="signed" Size="8" Signed="true"/>
+                          <BooleanParameter Name="bool"/>
+                          <FixedPointParameter Name="fixed" Size="16" Integral="3"/>)";
+    ParameterFramework pfw{config};
+    REQUIRE_NOTHROW(pfw.start());
+
+    ElementHandle integer(pfw, "/test/test/integer");
+    ElementHandle signedInteger(pfw, "/test/test/signed");
+    ElementHandle fixed(pfw, "/test/test/fixed");
+
+    // Warm up, the first write of the blackboard unshares its content
+    REQUIRE_NOTHROW(integer.setAsInteger(1));
+
+    WHEN ("Accessing parameters through element handles") {
+        uint32_t unsignedValue;
+        int32_t signedValue;
+        double doubleValue;
+
+        THEN ("Successful sets and gets allocate nothing") {
+            CHECK(allocationsOf([&] { integer.setAsInteger(42); }) == 0);
+            CHECK(allocationsOf([&] { integer.getAsInteger(unsignedValue); }) == 0);
+            CHECK(allocationsOf([&] { signedInteger.setAsSignedInteger(-42); }) == 0);
+            CHECK(allocationsOf([&] { signedInteger.getAsSignedInteger(signedValue); }) == 0);
+            CHECK(allocationsOf([&] { fixed.setAsDouble(1.5); }) == 0);
+            CHECK(allocationsOf([&] { fixed.getAsDouble(doubleValue); }) == 0);
+        }
+    }
+    WHEN ("Accessing parameters through scalar handles") {
+        auto integerHandle = pfw.createScalarHandle<uint32_t>("/test/test/integer");
+        auto boolHandle = pfw.createScalarHandle<bool>("/test/test/bool");
+        std::string error;
+
+        THEN ("Successful sets and gets allocate nothing") {
+            CHECK(allocationsOf([&] { integerHandle->set(42, error); }) == 0);
+            CHECK(allocationsOf([&] { integerHandle->get(); }) == 0);
+            CHECK(allocationsOf([&] { boolHandle->set(true, error); }) == 0);
+        }
+    }
+}
+
+} // namespace parameterFramework
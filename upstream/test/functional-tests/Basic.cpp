@@ -32,14 +32,25 @@
 #include "Config.hpp"
 #include "StoreLogger.hpp"
 #include "ParameterFramework.hpp"
+#include "ElementHandle.hpp"
+#include "TmpFile.hpp"
 
 #include <catch.hpp>
 
+#include <chrono>
+#include <fstream>
+#include <iterator>
 #include <list>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <cstdio>
 
+#include <stdlib.h>
+#include <unistd.h>
+
 namespace parameterFramework
 {
 
@@ -178,4 +189,557 @@ SCENARIO_METHOD(ParameterFramework, "Raw value space")
     }
 }
 
+SCENARIO("Element paths", "[structure][path]")
+{
+    Config config;
+    config.instances = R"(<ParameterBlock Name="block">
+                              <IntegerParameter Name="a" Size="8"/>
+                              <IntegerParameter Name="array" Size="8" ArrayLength="4"/>
+                          </ParameterBlock>)";
+    ParameterFramework pfw{config};
+    REQUIRE_NOTHROW(pfw.start());
+    REQUIRE_NOTHROW(pfw.setTuningMode(true));
+
+    auto get = [&pfw](const std::string &path) {
+        std::string value;
+        pfw.getParameter(path, value);
+        return value;
+    };
+    auto set = [&pfw](const std::string &path, std::string value) {
+        pfw.setParameter(path, value);
+    };
+
+    WHEN ("A parameter is accessed several times by its path") {
+        REQUIRE_NOTHROW(set("/test/test/block/a", "3"));
+        REQUIRE_NOTHROW(set("/test/test/block/a", "4"));
+
+        THEN ("The same parameter is accessed") {
+            CHECK(get("/test/test/block/a") == "4");
+            CHECK(get("/test/test/block/a") == "4");
+        }
+    }
+    WHEN ("An array item is accessed by its path") {
+        REQUIRE_NOTHROW(get("/test/test/block/array"));
+        REQUIRE_NOTHROW(set("/test/test/block/array/2", "7"));
+
+        THEN ("Only that item changes") {
+            CHECK(get("/test/test/block/array/2") == "7");
+            CHECK(get("/test/test/block/array") == "0 0 7 0");
+        }
+    }
+    THEN ("Elements that are not parameters can not be accessed as parameters") {
+        REQUIRE_NOTHROW(ElementHandle(pfw, "/test/test/block"));
+        CHECK_THROWS_AS(get("/test/test/block"), Exception);
+        CHECK_THROWS_AS(get("/test/test/block"), Exception);
+    }
+    THEN ("Paths of no element are rejected") {
+        for (auto &path : {"/test/test/block/b", "/other/test/block/a", "test/test/block/a",
+                           "/test/test/block/array/4", "/test/test/block/a/0"}) {
+            CHECK_THROWS_AS(get(path), Exception);
+            CHECK_THROWS_AS(get(path), Exception);
+        }
+    }
+}
+
+SCENARIO("Structure image", "[structure][image]")
+{
+    GIVEN ("A structure XIncluding a file and a location holding no valid structure image") {
+        utility::TmpFile included("<IntegerParameter Name='included' Size='8'/>");
+        utility::TmpFile image("");
+
+        Config config;
+        config.instances = "<BooleanParameter Name='bool'/>"
+                           "<xi:include xmlns:xi='http://www.w3.org/2001/XInclude' href='" +
+                           included.getPath() + "'/>";
+        config.structureImage = image.getPath();
+
+        StoreLogger logger{};
+
+        WHEN ("A Pfw starts") {
+            auto model = CParameterMgrFullConnector::createModel();
+            ParameterFramework pfw{config, model};
+            pfw.setLogger(&logger);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("The structure is loaded from the XML files") {
+                CHECK(logger.hasLogged("not used"));
+                CHECK(logger.hasLogged("Importing system structure from file"));
+            }
+            AND_WHEN ("Another Pfw of the same structure file and model starts") {
+                config.structurePath = pfw.getStructurePath();
+                StoreLogger otherLogger{};
+                ParameterFramework otherPfw{config, model};
+                otherPfw.setLogger(&otherLogger);
+                REQUIRE_NOTHROW(otherPfw.start());
+
+                THEN ("The structure is loaded from the image") {
+                    CHECK(otherLogger.hasLogged("from structure image"));
+                    CHECK_FALSE(otherLogger.hasLogged("not used"));
+                    std::string value;
+                    REQUIRE_NOTHROW(otherPfw.getParameter("/test/test/included", value));
+                    CHECK(value == "0");
+                    CHECK_NOTHROW(otherPfw.getParameter("/test/test/bool", value));
+                }
+            }
+            AND_WHEN ("The XIncluded file changes") {
+                std::ofstream(included.getPath()) << "<IntegerParameter Name='included'/>";
+
+                config.structurePath = pfw.getStructurePath();
+                StoreLogger otherLogger{};
+                ParameterFramework otherPfw{config};
+                otherPfw.setLogger(&otherLogger);
+                REQUIRE_NOTHROW(otherPfw.start());
+
+                THEN ("The structure is loaded from the XML files") {
+                    CHECK(otherLogger.hasLogged("changed since the structure image was built"));
+                    CHECK(otherLogger.hasLogged("Importing system structure from file"));
+                }
+            }
+            AND_WHEN ("A Pfw of another structure file of the same content starts") {
+                StoreLogger otherLogger{};
+                ParameterFramework otherPfw{config};
+                otherPfw.setLogger(&otherLogger);
+                REQUIRE_NOTHROW(otherPfw.start());
+
+                THEN ("The structure is loaded from the XML files") {
+                    CHECK(otherLogger.hasLogged("built from another structure file"));
+                    CHECK(otherLogger.hasLogged("Importing system structure from file"));
+                }
+            }
+        }
+    }
+    GIVEN ("A structure including a subsystem file and a location holding no valid image") {
+        utility::TmpFile subsystem("<Subsystem Name='included' Type='Virtual'><ComponentLibrary/>"
+                                   "<InstanceDefinition><IntegerParameter Name='p' Size='8'/>"
+                                   "</InstanceDefinition></Subsystem>");
+        utility::TmpFile image("");
+
+        Config config;
+        config.subsystemIncludes = "<SubsystemInclude Path='" + subsystem.getPath() + "'/>";
+        config.structureImage = image.getPath();
+
+        WHEN ("A Pfw starts after a first one of the same files built the image") {
+            ParameterFramework first{config};
+            REQUIRE_NOTHROW(first.start());
+
+            config.structurePath = first.getStructurePath();
+            StoreLogger logger{};
+            ParameterFramework pfw{config};
+            pfw.setLogger(&logger);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("The included subsystem is loaded from the image") {
+                CHECK(logger.hasLogged("from structure image"));
+                std::string value;
+                CHECK_NOTHROW(pfw.getParameter("/test/included/p", value));
+            }
+        }
+    }
+}
+
+SCENARIO("Included subsystems", "[structure][include]")
+{
+    auto subsystem = [](const std::string &name) {
+        return "<Subsystem Name='" + name + "' Type='Virtual'><ComponentLibrary/>"
+                                            "<InstanceDefinition><IntegerParameter Name='" +
+               name + "' Size='8'/></InstanceDefinition></Subsystem>";
+    };
+    utility::TmpFile first(subsystem("first"));
+    utility::TmpFile second(subsystem("second"));
+
+    GIVEN ("A structure including several subsystem files") {
+        Config config;
+        config.subsystemIncludes = "<SubsystemInclude Path='" + first.getPath() + "'/>"
+                                   "<SubsystemInclude Path='" + second.getPath() + "'/>";
+
+        WHEN ("A Pfw starts") {
+            ParameterFramework pfw{config};
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Each included subsystem is loaded") {
+                std::string value;
+                CHECK_NOTHROW(pfw.getParameter("/test/first/first", value));
+                CHECK_NOTHROW(pfw.getParameter("/test/second/second", value));
+            }
+        }
+        WHEN ("A Pfw mapping one subsystem at a time starts") {
+            ParameterFramework pfw{config};
+            CHECK(pfw.getMappingConcurrency() == std::thread::hardware_concurrency());
+            REQUIRE_NOTHROW(pfw.setMappingConcurrency(1));
+            CHECK(pfw.getMappingConcurrency() == 1);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Each included subsystem is loaded") {
+                std::string value;
+                CHECK_NOTHROW(pfw.getParameter("/test/first/first", value));
+                CHECK_NOTHROW(pfw.getParameter("/test/second/second", value));
+            }
+            THEN ("The mapping of each subsystem is profiled") {
+                std::string profile = pfw.getStartupProfile();
+                for (auto &name : {"test", "first", "second"}) {
+                    CHECK(profile.find(std::string("\n        Subsystem ") + name + ": wall ") !=
+                          std::string::npos);
+                }
+            }
+            THEN ("Concurrency can not be changed while running") {
+                CHECK_THROWS_AS(pfw.setMappingConcurrency(2), Exception);
+            }
+        }
+    }
+    GIVEN ("A structure including a missing subsystem file") {
+        Config config;
+        config.subsystemIncludes = "<SubsystemInclude Path='" + first.getPath() + "'/>"
+                                   "<SubsystemInclude Path='" + first.getPath() + ".missing'/>";
+
+        THEN ("Start should fail") {
+            ParameterFramework pfw{config};
+            CHECK_THROWS_AS(pfw.start(), Exception);
+        }
+    }
+}
+
+SCENARIO("Frameworks of identical structures", "[structure][share]")
+{
+    auto model = CParameterMgrFullConnector::createModel();
+    Config config;
+    config.instances = "<IntegerParameter Name='p' Size='8'/>";
+    std::unique_ptr<ParameterFramework> first(new ParameterFramework{config, model});
+    REQUIRE_NOTHROW(first->start());
+    ParameterFramework second{config, model};
+    REQUIRE_NOTHROW(second.start());
+    REQUIRE_NOTHROW(second.setTuningMode(true));
+
+    auto get = [](ParameterFramework &pfw) {
+        std::string value;
+        REQUIRE_NOTHROW(pfw.getParameter("/test/test/p", value));
+        return value;
+    };
+    auto set = [](ParameterFramework &pfw, std::string value) {
+        pfw.setParameter("/test/test/p", value);
+    };
+
+    WHEN ("The framework that started first is destroyed") {
+        first.reset();
+
+        THEN ("The other one still checks the values of its parameters against their type") {
+            REQUIRE_NOTHROW(set(second, "100"));
+            CHECK(get(second) == "100");
+            CHECK_THROWS_AS(set(second, "300"), Exception);
+        }
+    }
+    WHEN ("A framework of another structure starts once none of that structure is left") {
+        Config other;
+        other.instances = "<BooleanParameter Name='p'/>";
+        {
+            ParameterFramework released{other, model};
+            REQUIRE_NOTHROW(released.start());
+        }
+        ParameterFramework third{other, model};
+        REQUIRE_NOTHROW(third.start());
+        REQUIRE_NOTHROW(third.setTuningMode(true));
+
+        THEN ("It parses its types again") {
+            REQUIRE_NOTHROW(set(third, "1"));
+            CHECK(get(third) == "1");
+            CHECK_THROWS_AS(set(third, "2"), Exception);
+        }
+    }
+    GIVEN ("A framework whose structure only differs by the size of a parameter") {
+        Config other;
+        other.instances = "<IntegerParameter Name='p' Size='16'/>";
+        ParameterFramework third{other, model};
+        REQUIRE_NOTHROW(third.start());
+        REQUIRE_NOTHROW(third.setTuningMode(true));
+
+        THEN ("Each framework keeps its own parameter type") {
+            REQUIRE_NOTHROW(set(third, "300"));
+            CHECK(get(third) == "300");
+            CHECK_THROWS_AS(set(second, "300"), Exception);
+        }
+    }
+}
+
+SCENARIO("Schema validation", "[structure][xml][schema]")
+{
+    auto subsystem = [](const std::string &attributes) {
+        return "<Subsystem Name='included' Type='Virtual'><ComponentLibrary/>"
+               "<InstanceDefinition><IntegerParameter Name='p' " +
+               attributes + "/></InstanceDefinition></Subsystem>";
+    };
+    utility::TmpFile valid(subsystem("Size='32'"));
+    utility::TmpFile invalid(subsystem("Size='32' Unknown='1'"));
+
+    auto start = [](const utility::TmpFile &file) {
+        Config config;
+        config.instances = "<IntegerParameter Name='p' Size='32'/>";
+        config.subsystemIncludes = "<SubsystemInclude Path='" + file.getPath() + "'/>";
+        ParameterFramework pfw{config};
+        pfw.setSchemaUri(SCHEMAS_DIR);
+        REQUIRE_NOTHROW(pfw.setValidateSchemasOnStart(true));
+        try {
+            pfw.start();
+        } catch (Exception &exception) {
+            return std::string(exception.what());
+        }
+        return std::string();
+    };
+
+    GIVEN ("A Pfw validating a valid structure against the schemas") {
+        REQUIRE(start(valid).empty());
+
+        WHEN ("Another Pfw validates an invalid structure against the same schemas") {
+            auto error = start(invalid);
+
+            THEN ("It fails naming the invalid file and what the schema rejects") {
+                INFO(error);
+                CHECK(error.find(invalid.getPath() + ":1:") != std::string::npos);
+                CHECK(error.find("'Unknown' is not allowed") != std::string::npos);
+            }
+        }
+    }
+}
+
+SCENARIO("Startup profile", "[log][profile]")
+{
+    GIVEN ("A Pfw logging its startup profile") {
+        StoreLogger logger{};
+        ParameterFramework pfw;
+        pfw.setLogger(&logger);
+        pfw.setStartupProfileLogging(true);
+        CHECK(pfw.getStartupProfileLogging());
+
+        WHEN ("It starts") {
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Each start phase is profiled") {
+                std::string profile = "\n" + pfw.getStartupProfile();
+                for (auto &phase : {"Element libraries", "Framework configuration", "Plugins",
+                                    "Structure", "Settings", "Init", "Back synchronization",
+                                    "Domain validation", "Initial application"}) {
+                    CHECK(profile.find(std::string("\n") + phase + ": wall ") !=
+                          std::string::npos);
+                }
+            }
+            THEN ("Subsystems are profiled as part of the structure") {
+                CHECK(pfw.getStartupProfile().find("\n    Subsystem test: wall ") !=
+                      std::string::npos);
+                CHECK(pfw.getStartupProfile().find("\n    Subsystem mapping: wall ") !=
+                      std::string::npos);
+                CHECK(pfw.getStartupProfile().find("\n        Subsystem test: wall ") !=
+                      std::string::npos);
+            }
+            THEN ("The profile is logged") {
+                CHECK(logger.hasLogged("Startup profile"));
+            }
+        }
+    }
+}
+
+SCENARIO("Concurrent back synchronization", "[structure][backSynchronization]")
+{
+    // The TEST subsystems read their parameters and their health from a directory
+    char directory[20] = "/tmp/pfwLanesXXXXXX";
+    REQUIRE(mkdtemp(directory) != nullptr);
+    REQUIRE(setenv("PFW_RESULT", directory, 1) == 0);
+    std::ofstream(std::string(directory) + "/isAlive") << "true";
+
+    // Each subsystem finds a distinct, non default, value in the hardware
+    const std::vector<std::string> names{"first", "second", "third", "fourth", "fifth"};
+    for (size_t index = 0; index < names.size(); index++) {
+        std::ofstream(std::string(directory) + "/" + names[index]) << "0x" << index + 1;
+    }
+
+    auto subsystem = [&directory](const std::string &name) {
+        return "<Subsystem Name='" + name + "' Type='TEST' Mapping='Directory:" + directory +
+               "'><ComponentLibrary/><InstanceDefinition><IntegerParameter Name='" + name +
+               "' Size='32' Mapping='Binary'/></InstanceDefinition></Subsystem>";
+    };
+    std::vector<std::unique_ptr<utility::TmpFile>> files;
+    Config config;
+    config.plugins = {{"", {"test-subsystem"}}};
+    for (auto &name : names) {
+        files.emplace_back(new utility::TmpFile(subsystem(name)));
+        config.subsystemIncludes += "<SubsystemInclude Path='" + files.back()->getPath() + "'/>";
+    }
+
+    GIVEN ("A Pfw back synchronizing several subsystems concurrently") {
+        ParameterFramework pfw{config};
+        REQUIRE_NOTHROW(pfw.setBackSynchronizationConcurrency(4));
+        CHECK(pfw.getBackSynchronizationConcurrency() == 4);
+
+        WHEN ("It starts") {
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Every subsystem holds the values read from its hardware") {
+                for (size_t index = 0; index < names.size(); index++) {
+                    std::string value;
+                    REQUIRE_NOTHROW(pfw.getParameter(
+                        "/test/" + names[index] + "/" + names[index], value));
+                    CHECK(value == std::to_string(index + 1));
+                }
+            }
+            THEN ("The mapping of each subsystem is profiled") {
+                std::string profile = pfw.getStartupProfile();
+                for (auto &name : names) {
+                    CHECK(profile.find("\n        Subsystem " + name + ": wall ") !=
+                          std::string::npos);
+                }
+            }
+            THEN ("Concurrency can not be changed while running") {
+                CHECK_THROWS_AS(pfw.setBackSynchronizationConcurrency(1), Exception);
+            }
+        }
+    }
+
+    for (auto &name : names) {
+        unlink((std::string(directory) + "/" + name).c_str());
+    }
+    unlink((std::string(directory) + "/isAlive").c_str());
+    rmdir(directory);
+}
+
+/** Report the time to create a handle on each of 40000 parameters, then to create them again.
+ * Hidden from default runs, select it with the "[benchmark]" tag.
+ */
+TEST_CASE("Path lookup benchmark", "[.][benchmark]")
+{
+    const size_t componentCount = 5000;
+    const size_t parameterCount = 8;
+
+    Config config;
+    config.components = "<ComponentType Name='channel'>";
+    for (size_t parameter = 0; parameter < parameterCount; parameter++) {
+        config.components +=
+            "<IntegerParameter Name='p" + std::to_string(parameter) + "' Size='16'/>";
+    }
+    config.components += "</ComponentType>";
+    config.instances = "<Component Name='channels' Type='channel' ArrayLength='" +
+                       std::to_string(componentCount) + "'/>";
+
+    ParameterFramework pfw{config};
+    REQUIRE_NOTHROW(pfw.start());
+
+    std::vector<std::string> paths;
+    for (size_t component = 0; component < componentCount; component++) {
+        for (size_t parameter = 0; parameter < parameterCount; parameter++) {
+            paths.push_back("/test/test/channels/" + std::to_string(component) + "/p" +
+                            std::to_string(parameter));
+        }
+    }
+    std::string report = std::to_string(paths.size()) + " handle creations:";
+    for (auto pass : {"first", "again"}) {
+        auto start = std::chrono::steady_clock::now();
+        for (auto &path : paths) {
+            ElementHandle handle(pfw, path);
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+        report += std::string(" ") + pass + " " + std::to_string(duration.count()) + " ms";
+    }
+    WARN(report);
+}
+
+/** Report the time and peak memory growth of loading a structure of 5000 components of 8
+ * parameters each. Hidden from default runs, select it with the "[benchmark]" tag.
+ */
+TEST_CASE("Structure benchmark", "[.][benchmark]")
+{
+    Config config;
+    config.components = "<ComponentType Name='channel' Mapping='Amend1:Channel'>";
+    for (auto &name : {"playback_volume_db", "balance_left_right", "bass_boost_level",
+                       "treble_boost_level", "input_gain_level", "output_delay_samples",
+                       "phase_inversion_on", "mute_on_headset_out"}) {
+        config.components += std::string("<IntegerParameter Name='") + name +
+                             "' Size='16' Mapping='Control:" + name + "'/>";
+    }
+    config.components += "</ComponentType>";
+    config.instances = "<Component Name='channels' Type='channel' ArrayLength='5000'/>";
+
+    ParameterFramework pfw{config};
+    REQUIRE_NOTHROW(pfw.start());
+
+    std::string profile = "\n" + pfw.getStartupProfile();
+    auto structure = profile.find("\nStructure: ");
+    REQUIRE(structure != std::string::npos);
+    WARN("5000 components, " + profile.substr(structure + 1, profile.find('\n', structure + 1) -
+                                                                 structure - 1));
+}
+
+/** Report the time of loading a structure including 16 subsystem files of 2000 parameters each,
+ * validated against their schema. Hidden from default runs, select it with the "[benchmark]"
+ * tag.
+ */
+TEST_CASE("Validated includes benchmark", "[.][benchmark]")
+{
+    std::vector<std::unique_ptr<utility::TmpFile>> files;
+    Config config;
+    config.instances = "<IntegerParameter Name='p' Size='8'/>";
+    for (size_t subsystem = 0; subsystem < 16; subsystem++) {
+        std::string xml = "<Subsystem Name='s" + std::to_string(subsystem) +
+                          "' Type='Virtual'><ComponentLibrary/><InstanceDefinition>";
+        for (size_t parameter = 0; parameter < 2000; parameter++) {
+            xml += "<IntegerParameter Name='p" + std::to_string(parameter) + "' Size='16'/>";
+        }
+        files.emplace_back(new utility::TmpFile(xml + "</InstanceDefinition></Subsystem>"));
+        config.subsystemIncludes += "<SubsystemInclude Path='" + files.back()->getPath() + "'/>";
+    }
+    ParameterFramework pfw{config};
+    pfw.setSchemaUri(SCHEMAS_DIR);
+    REQUIRE_NOTHROW(pfw.setValidateSchemasOnStart(true));
+    REQUIRE_NOTHROW(pfw.start());
+
+    std::string profile = "\n" + pfw.getStartupProfile();
+    auto structure = profile.find("\nStructure: ");
+    REQUIRE(structure != std::string::npos);
+    WARN("16 validated subsystem files, " +
+         profile.substr(structure + 1, profile.find('\n', structure + 1) - structure - 1));
+}
+
+/** Report the time of loading a structure of 20000 parameters of 2500 distinct component types,
+ * from the XML files then from the structure image. Hidden from default runs, select it with the
+ * "[benchmark]" tag.
+ */
+TEST_CASE("Structure image benchmark", "[.][benchmark]")
+{
+    utility::TmpFile image("");
+    Config config;
+    for (size_t component = 0; component < 2500; component++) {
+        std::string type = "channel" + std::to_string(component);
+        config.components += "<ComponentType Name='" + type + "' Mapping='Amend1:" + type + "'>";
+        for (size_t parameter = 0; parameter < 8; parameter++) {
+            std::string name = "p" + std::to_string(parameter);
+            config.components += "<IntegerParameter Name='" + name + "' Size='16' Max='1000' "
+                                                                     "Mapping='Control:" +
+                                 name + "'/>";
+        }
+        config.components += "</ComponentType>";
+        config.instances += "<Component Name='" + type + "' Type='" + type + "'/>";
+    }
+    config.structureImage = image.getPath();
+
+    // The image is keyed on the structure file, which has to outlive the Pfw building the image
+    std::string structureXml;
+    {
+        ParameterFramework generator{config};
+        std::ifstream file(generator.getStructurePath());
+        structureXml.assign(std::istreambuf_iterator<char>(file),
+                            std::istreambuf_iterator<char>());
+    }
+    utility::TmpFile structureFile(structureXml);
+    config.structurePath = structureFile.getPath();
+
+    std::string report = "20000 parameters, Structure:";
+    for (auto source : {"XML", "image"}) {
+        ParameterFramework pfw{config};
+        REQUIRE_NOTHROW(pfw.start());
+
+        std::string profile = "\n" + pfw.getStartupProfile();
+        auto structure = profile.find("\nStructure: ");
+        REQUIRE(structure != std::string::npos);
+        report += std::string(" from ") + source + " " +
+                  profile.substr(structure + 12, profile.find(',', structure) - structure - 12);
+    }
+    WARN(report);
+}
+
 } // parameterFramework
@@ -0,0 +1,1054 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "ElementHandle.hpp"
+#include "StoreLogger.hpp"
+#include "TmpFile.hpp"
+#include <CommandHandlerInterface.h>
+#include <catch.hpp>
+#include <libxml/parser.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+/** A parameter framework whose configurations all hold the same settings. */
+struct IdenticalSettingsPF : public ParameterFramework
+{
+    /** @param[in] aAttributes extra attributes of the "a" parameter type */
+    IdenticalSettingsPF(const string &settingsImage = "", const string &aAttributes = "")
+        : ParameterFramework{createConfig(settingsImage, aAttributes)}
+    {
+    }
+
+    string getValue(const string &configuration, const string &parameter)
+    {
+        string value;
+        getConfigurationParameter("Domain", configuration, "/test/test/block/" + parameter, value);
+        return value;
+    }
+
+    string showSettingsMemory()
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        string output;
+        CHECK(commandHandler->process("showSettingsMemory", {}, output));
+        return output;
+    }
+
+    string diffConfigurations(const string &configuration, const string &otherConfiguration)
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        string output;
+        CHECK(commandHandler->process("diffConfigurations",
+                                      {"Domain", configuration, otherConfiguration}, output));
+        return output;
+    }
+
+private:
+    static Config createConfig(const string &settingsImage, const string &aAttributes)
+    {
+        Config config;
+        config.settingsImage = settingsImage;
+        config.instances = R"(<ParameterBlock Name="block">
+                                  <IntegerParameter Name="a" Size="32" )" +
+                           aAttributes + R"(/>
+                                  <IntegerParameter Name="b" Size="32"/>
+                                  <IntegerParameter Name="array" Size="8" ArrayLength="64"/>
+                              </ParameterBlock>)";
+
+        string arraySettings;
+        for (size_t i = 0; i < 64; i++) {
+            arraySettings += "0 ";
+        }
+        string settings = R"(<ConfigurableElement Path="/test/test/block">
+                                 <ParameterBlock Name="block">
+                                     <IntegerParameter Name="a">1</IntegerParameter>
+                                     <IntegerParameter Name="b">2</IntegerParameter>
+                                     <IntegerParameter Name="array">)" +
+                          arraySettings + R"(</IntegerParameter>
+                                 </ParameterBlock>
+                             </ConfigurableElement>)";
+
+        config.domains = R"(<ConfigurableDomain Name="Domain">
+                                <Configurations>
+                                    <Configuration Name="One">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                    <Configuration Name="Two">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                    <Configuration Name="Three">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/block"/>
+                                </ConfigurableElements>
+                                <Settings>
+                                    <Configuration Name="One">)" +
+                         settings + R"(</Configuration>
+                                    <Configuration Name="Two">)" +
+                         settings + R"(</Configuration>
+                                    <Configuration Name="Three">)" +
+                         settings + R"(</Configuration>
+                                </Settings>
+                            </ConfigurableDomain>)";
+        return config;
+    }
+};
+
+SCENARIO_METHOD(IdenticalSettingsPF, "Identical configuration settings", "[settings]")
+{
+    GIVEN ("A Pfw that starts") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Identical settings are stored once") {
+            CHECK(showSettingsMemory() == "Area configurations: 3\n"
+                                          "Shared payloads: 1\n"
+                                          "Compressed configurations: 0\n"
+                                          "Configurations pending in settings image: 0\n"
+                                          "Settings size: 216 bytes\n"
+                                          "Stored size: 72 bytes\n"
+                                          "Saved by sharing: 144 bytes\n"
+                                          "Saved by compression: 0 bytes\n"
+                                          "Inflations: 0\n"
+                                          "Inflation duration: 0 us (max 0 us)\n");
+        }
+        WHEN ("A configuration parameter is modified") {
+            string value = "42";
+            REQUIRE_NOTHROW(
+                setConfigurationParameter("Domain", "Two", "/test/test/block/a", value));
+
+            THEN ("Only this configuration is affected") {
+                CHECK(getValue("One", "a") == "1");
+                CHECK(getValue("Two", "a") == "42");
+                CHECK(getValue("Three", "a") == "1");
+                CHECK(getValue("Two", "b") == "2");
+            }
+            THEN ("The other configurations still share their settings") {
+                CHECK(showSettingsMemory() == "Area configurations: 3\n"
+                                              "Shared payloads: 1\n"
+                                              "Compressed configurations: 0\n"
+                                              "Configurations pending in settings image: 0\n"
+                                              "Settings size: 216 bytes\n"
+                                              "Stored size: 144 bytes\n"
+                                              "Saved by sharing: 72 bytes\n"
+                                              "Saved by compression: 0 bytes\n"
+                                              "Inflations: 0\n"
+                                              "Inflation duration: 0 us (max 0 us)\n");
+            }
+        }
+        WHEN ("A configuration is saved from modified parameters") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            string value = "7";
+            REQUIRE_NOTHROW(setParameter("/test/test/block/b", value));
+            REQUIRE_NOTHROW(saveConfiguration("Domain", "Three"));
+
+            THEN ("Only this configuration is affected") {
+                // "One" is the applied configuration, hence not checked as its values are read
+                // from the main blackboard
+                CHECK(getValue("Two", "b") == "2");
+                CHECK(getValue("Three", "b") == "7");
+            }
+            AND_WHEN ("Another configuration is saved with the same values") {
+                REQUIRE_NOTHROW(saveConfiguration("Domain", "Two"));
+
+                THEN ("Both configurations share their settings") {
+                    CHECK(showSettingsMemory() == "Area configurations: 3\n"
+                                                  "Shared payloads: 2\n"
+                                                  "Compressed configurations: 0\n"
+                                                  "Configurations pending in settings image: 0\n"
+                                                  "Settings size: 216 bytes\n"
+                                                  "Stored size: 144 bytes\n"
+                                                  "Saved by sharing: 72 bytes\n"
+                                                  "Saved by compression: 0 bytes\n"
+                                                  "Inflations: 0\n"
+                                                  "Inflation duration: 0 us (max 0 us)\n");
+                }
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(IdenticalSettingsPF, "Idle configuration settings compression", "[settings]")
+{
+    GIVEN ("A Pfw that starts") {
+        REQUIRE_NOTHROW(start());
+
+        uint32_t idleDelayMs;
+        THEN ("Settings compression is disabled by default") {
+            CHECK_FALSE(getSettingsCompression(idleDelayMs));
+        }
+        WHEN ("Settings compression is enabled with no delay") {
+            setSettingsCompression(true, 0);
+            CHECK(getSettingsCompression(idleDelayMs));
+            CHECK(idleDelayMs == 0);
+
+            AND_WHEN ("Configurations are applied") {
+                applyConfigurations();
+
+                THEN ("All configurations but the applied one are compressed") {
+                    string report = showSettingsMemory();
+                    CHECK(report.find("Compressed configurations: 2\n") != string::npos);
+                    CHECK(report.find("Saved by compression: 0 bytes") == string::npos);
+                    CHECK(report.find("Inflations: 0\n") != string::npos);
+                }
+                THEN ("Compressed settings are inflated back on access") {
+                    CHECK(getValue("Two", "a") == "1");
+                    CHECK(getValue("Two", "b") == "2");
+
+                    string report = showSettingsMemory();
+                    CHECK(report.find("Compressed configurations: 1\n") != string::npos);
+                    CHECK(report.find("Inflations: 1\n") != string::npos);
+                }
+            }
+        }
+        WHEN ("Settings compression is enabled with a long delay") {
+            setSettingsCompression(true, 3600 * 1000);
+
+            AND_WHEN ("Configurations are applied") {
+                applyConfigurations();
+
+                THEN ("No configuration is compressed") {
+                    CHECK(showSettingsMemory().find("Compressed configurations: 0\n") !=
+                          string::npos);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(IdenticalSettingsPF, "Settings compression concurrent with settings accesses",
+                "[settings]")
+{
+    GIVEN ("A Pfw that starts with settings compression enabled with no delay") {
+        REQUIRE_NOTHROW(start());
+        setSettingsCompression(true, 0);
+
+        WHEN ("Configurations are applied while their settings are read") {
+            // Each application compresses the configurations the reads inflate
+            std::atomic<bool> stop{false};
+            std::thread applier([&] {
+                while (not stop) {
+                    applyConfigurations();
+                }
+            });
+            std::vector<string> values;
+            std::vector<string> diffs;
+            for (size_t i = 0; i < 200; i++) {
+                values.push_back(getValue("Two", "b"));
+                diffs.push_back(diffConfigurations("Two", "Three"));
+                string xmlDomains;
+                exportDomainsXml(xmlDomains, true, false);
+            }
+            stop = true;
+            applier.join();
+
+            THEN ("The settings read are intact") {
+                CHECK(std::all_of(begin(values), end(values),
+                                  [](const string &value) { return value == "2"; }));
+                CHECK(std::all_of(begin(diffs), end(diffs),
+                                  [](const string &diff) { return diff.empty(); }));
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(IdenticalSettingsPF, "Configuration settings comparison", "[settings]")
+{
+    GIVEN ("A Pfw that starts") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Identical configurations have no differing parameter") {
+            CHECK(diffConfigurations("Two", "Three") == "");
+        }
+        THEN ("Comparing with an unknown configuration fails") {
+            std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+            string output;
+            CHECK_FALSE(
+                commandHandler->process("diffConfigurations", {"Domain", "Two", "Four"}, output));
+        }
+        WHEN ("Configuration parameters are modified") {
+            string value = "5";
+            REQUIRE_NOTHROW(
+                setConfigurationParameter("Domain", "Two", "/test/test/block/a", value));
+            string arrayValue;
+            for (size_t i = 0; i < 64; i++) {
+                arrayValue += i == 42 ? "3 " : "0 ";
+            }
+            REQUIRE_NOTHROW(
+                setConfigurationParameter("Domain", "Two", "/test/test/block/array", arrayValue));
+
+            THEN ("Only the modified parameters differ") {
+                CHECK(diffConfigurations("Two", "Three") ==
+                      "/test/test/block/a\n/test/test/block/array\n");
+                CHECK(diffConfigurations("Three", "Two") ==
+                      "/test/test/block/a\n/test/test/block/array\n");
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(IdenticalSettingsPF, "Parameter change subscription", "[settings][subscription]")
+{
+    GIVEN ("A Pfw that starts") {
+        REQUIRE_NOTHROW(start());
+
+        using Notifications = std::vector<std::vector<string>>;
+        Notifications blockNotifications;
+        Notifications bNotifications;
+        ElementHandle block(*this, "/test/test/block");
+        ElementHandle b(*this, "/test/test/block/b");
+
+        uint32_t notifiedValue = 0;
+        auto blockSubscription =
+            block.subscribeToChanges([&](const std::vector<string> &changedParameters) {
+                blockNotifications.push_back(changedParameters);
+                // Parameters are accessible from the callback
+                ElementHandle a(*this, "/test/test/block/a");
+                a.getAsInteger(notifiedValue);
+            });
+        b.subscribeToChanges([&](const std::vector<string> &changedParameters) {
+            bNotifications.push_back(changedParameters);
+        });
+
+        WHEN ("Configurations are applied without changing any parameter") {
+            applyConfigurations();
+
+            THEN ("Subscribers are not notified") {
+                CHECK(blockNotifications.empty());
+                CHECK(bNotifications.empty());
+            }
+        }
+        WHEN ("A tuned parameter is restored by the configuration application") {
+            setTuningMode(true);
+            string value = "7";
+            setParameter("/test/test/block/a", value);
+            setTuningMode(false);
+
+            THEN ("Subscribers of this parameter are notified once") {
+                CHECK(blockNotifications == Notifications{{"/test/test/block/a"}});
+                CHECK(notifiedValue == 1);
+            }
+            THEN ("Other subscribers are not notified") {
+                CHECK(bNotifications.empty());
+            }
+        }
+        WHEN ("A subscription is cancelled") {
+            block.unsubscribeFromChanges(blockSubscription);
+            setTuningMode(true);
+            string value = "7";
+            setParameter("/test/test/block/a", value);
+            setTuningMode(false);
+
+            THEN ("Its callback is not notified anymore") {
+                CHECK(blockNotifications.empty());
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(IdenticalSettingsPF, "Parameter modification polling", "[settings][epoch]")
+{
+    GIVEN ("A Pfw that starts") {
+        REQUIRE_NOTHROW(start());
+        uint64_t epoch = getEpoch();
+
+        THEN ("Nothing changed since the current epoch") {
+            CHECK(getChangedSince(epoch).empty());
+        }
+        WHEN ("Configurations are applied again") {
+            setTuningMode(true);
+            setTuningMode(false);
+
+            THEN ("Restoring identical settings is not a modification") {
+                CHECK(getEpoch() == epoch);
+            }
+        }
+        WHEN ("A parameter is modified") {
+            setTuningMode(true);
+            string value = "7";
+            setParameter("/test/test/block/a", value);
+
+            THEN ("The epoch is incremented") {
+                CHECK(getEpoch() > epoch);
+            }
+            THEN ("The parameter is listed as changed since the previous epoch") {
+                auto changed = getChangedSince(epoch);
+                CHECK(std::find(begin(changed), end(changed), "/test/test/block/a") !=
+                      end(changed));
+            }
+            THEN ("Nothing changed since the new epoch") {
+                CHECK(getChangedSince(getEpoch()).empty());
+            }
+            AND_WHEN ("It is set to the same value again") {
+                uint64_t newEpoch = getEpoch();
+                setParameter("/test/test/block/a", value);
+
+                THEN ("The epoch is unchanged") {
+                    CHECK(getEpoch() == newEpoch);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Settings image", "[settings][image]")
+{
+    GIVEN ("A settings image location holding no valid image") {
+        utility::TmpFile image("");
+        StoreLogger logger{};
+
+        WHEN ("A Pfw configured with it starts") {
+            IdenticalSettingsPF pfw(image.getPath());
+            pfw.setLogger(&logger);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Settings are loaded from the domains file") {
+                CHECK(logger.hasLogged("not used"));
+                CHECK(pfw.getValue("Two", "a") == "1");
+            }
+            AND_WHEN ("The image of modified settings is exported") {
+                string value = "42";
+                REQUIRE_NOTHROW(
+                    pfw.setConfigurationParameter("Domain", "Two", "/test/test/block/a", value));
+                REQUIRE_NOTHROW(pfw.exportSettingsImage(image.getPath()));
+
+                AND_WHEN ("Another Pfw configured with it starts") {
+                    StoreLogger otherLogger{};
+                    IdenticalSettingsPF otherPfw(image.getPath());
+                    otherPfw.setLogger(&otherLogger);
+                    REQUIRE_NOTHROW(otherPfw.start());
+
+                    THEN ("Settings are loaded from the image") {
+                        CHECK(otherLogger.hasLogged("Imported configurable domains from "
+                                                    "settings image"));
+                        CHECK(otherPfw.getValue("One", "a") == "1");
+                        CHECK(otherPfw.getValue("Two", "a") == "42");
+                        CHECK(otherPfw.getValue("Three", "b") == "2");
+                    }
+                }
+                AND_WHEN ("The image gets corrupted") {
+                    std::fstream file(image.getPath(),
+                                      std::ios::in | std::ios::out | std::ios::binary);
+                    file.seekp(-1, std::ios::end);
+                    file.put('\xff');
+                    file.close();
+
+                    StoreLogger otherLogger{};
+                    IdenticalSettingsPF otherPfw(image.getPath());
+                    otherPfw.setLogger(&otherLogger);
+                    REQUIRE_NOTHROW(otherPfw.start());
+
+                    THEN ("Settings are loaded from the domains file") {
+                        CHECK(otherLogger.hasLogged("Corrupted settings image"));
+                        CHECK(otherPfw.getValue("Two", "a") == "1");
+                    }
+                }
+            }
+        }
+        WHEN ("A Pfw starts after a first one built the image") {
+            {
+                IdenticalSettingsPF pfw(image.getPath());
+                REQUIRE_NOTHROW(pfw.start());
+            }
+            IdenticalSettingsPF pfw(image.getPath());
+            pfw.setLogger(&logger);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Settings are loaded from the image") {
+                CHECK(logger.hasLogged("Imported configurable domains from settings image"));
+                CHECK(pfw.getValue("Three", "a") == "1");
+            }
+        }
+        WHEN ("A Pfw with a parameter type changed but not resized starts after a first one "
+              "built the image") {
+            {
+                IdenticalSettingsPF pfw(image.getPath());
+                REQUIRE_NOTHROW(pfw.start());
+            }
+            IdenticalSettingsPF pfw(image.getPath(), "Signed='true' Min='-1' Max='1'");
+            pfw.setLogger(&logger);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("Settings are loaded from the domains file") {
+                CHECK(logger.hasLogged("Settings image built for another structure"));
+                CHECK(pfw.getValue("Three", "a") == "1");
+            }
+        }
+        WHEN ("A Pfw lazily loading settings starts after a first one built the image") {
+            {
+                IdenticalSettingsPF pfw(image.getPath());
+                REQUIRE_NOTHROW(pfw.start());
+            }
+            for (bool warmUp : {false, true}) {
+                IdenticalSettingsPF pfw(image.getPath());
+                REQUIRE_NOTHROW(pfw.setLazySettingsLoading(true, warmUp));
+                REQUIRE_NOTHROW(pfw.start());
+
+                bool isWarmedUp;
+                CHECK(pfw.getLazySettingsLoading(isWarmedUp));
+                CHECK(isWarmedUp == warmUp);
+                CHECK_THROWS_AS(pfw.setLazySettingsLoading(false, false), Exception);
+
+                if (not warmUp) {
+                    THEN ("The settings of configurations not applied stay in the image") {
+                        CHECK(pfw.showSettingsMemory().find(
+                                  "Configurations pending in settings image: 0") ==
+                              string::npos);
+                    }
+                }
+                THEN ("Settings are loaded from the image on use") {
+                    CHECK(pfw.getValue("One", "b") == "2");
+                    CHECK(pfw.getValue("Three", "a") == "1");
+                    CHECK(pfw.diffConfigurations("Two", "Three").empty());
+                }
+                THEN ("Settings left in the image can be tuned") {
+                    REQUIRE_NOTHROW(pfw.setTuningMode(true));
+                    string value = "7";
+                    REQUIRE_NOTHROW(
+                        pfw.setConfigurationParameter("Domain", "Three", "/test/test/block/a",
+                                                      value));
+                    CHECK(pfw.getValue("Three", "a") == "7");
+                    CHECK(pfw.getValue("Two", "a") == "1");
+                }
+            }
+        }
+        WHEN ("Several Pfws lazily load the image a first one built") {
+            {
+                IdenticalSettingsPF pfw(image.getPath());
+                REQUIRE_NOTHROW(pfw.start());
+            }
+            std::unique_ptr<IdenticalSettingsPF> first(new IdenticalSettingsPF(image.getPath()));
+            IdenticalSettingsPF second(image.getPath());
+            for (auto pfw : {first.get(), &second}) {
+                REQUIRE_NOTHROW(pfw->setLazySettingsLoading(true, false));
+                REQUIRE_NOTHROW(pfw->start());
+            }
+
+            THEN ("Each one keeps access to the image content once the others are gone") {
+                CHECK(first->getValue("Two", "a") == "1");
+                first.reset();
+                CHECK(second.getValue("Three", "b") == "2");
+            }
+        }
+    }
+}
+
+/** A domain of one configuration setting /test/test/param to a value. */
+static string domainXml(const string &name, const string &value)
+{
+    return R"(<ConfigurableDomain Name=")" + name + R"(">
+                  <Configurations>
+                      <Configuration Name="Default"><CompoundRule Type="All"/></Configuration>
+                  </Configurations>
+                  <ConfigurableElements>
+                      <ConfigurableElement Path="/test/test/)" +
+           name + R"("/>
+                  </ConfigurableElements>
+                  <Settings>
+                      <Configuration Name="Default">
+                          <ConfigurableElement Path="/test/test/)" +
+           name + R"(">
+                              <IntegerParameter Name=")" +
+           name + R"(">)" + value + R"(</IntegerParameter>
+                          </ConfigurableElement>
+                      </Configuration>
+                  </Settings>
+              </ConfigurableDomain>)";
+}
+
+SCENARIO("Domains import", "[settings][xml]")
+{
+    Config config;
+    config.instances = R"(<IntegerParameter Name="first" Size="32"/>
+                          <IntegerParameter Name="second" Size="32"/>)";
+
+    GIVEN ("A domains file including another domain file") {
+        utility::TmpFile included(domainXml("second", "2"));
+        config.domains = domainXml("first", "1") +
+                         "<xi:include xmlns:xi='http://www.w3.org/2001/XInclude' href='" +
+                         included.getPath() + "'/>";
+        ParameterFramework pfw{config};
+
+        for (bool validate : {false, true}) {
+            WHEN ("A Pfw starts, validating the files with their schemas: " +
+                  std::to_string(validate)) {
+                pfw.setSchemaUri(SCHEMAS_DIR);
+                REQUIRE_NOTHROW(pfw.setValidateSchemasOnStart(validate));
+                REQUIRE_NOTHROW(pfw.start());
+
+                THEN ("Both domains are imported") {
+                    string value;
+                    REQUIRE_NOTHROW(pfw.getConfigurationParameter("first", "Default",
+                                                                  "/test/test/first", value));
+                    CHECK(value == "1");
+                    REQUIRE_NOTHROW(pfw.getConfigurationParameter("second", "Default",
+                                                                  "/test/test/second", value));
+                    CHECK(value == "2");
+                }
+            }
+        }
+    }
+    GIVEN ("A domains file whose last domain is invalid") {
+        config.domains = domainXml("first", "1") + domainXml("second", "not a number");
+        ParameterFramework pfw{config};
+
+        THEN ("Start should fail") {
+            CHECK_THROWS_AS(pfw.start(), Exception);
+        }
+        WHEN ("Failing to load settings is allowed") {
+            pfw.setFailureOnFailedSettingsLoad(false);
+            REQUIRE_NOTHROW(pfw.start());
+
+            THEN ("The domains read before the invalid one are not kept") {
+                string value;
+                CHECK_THROWS_AS(pfw.getConfigurationParameter("first", "Default",
+                                                              "/test/test/first", value),
+                                Exception);
+            }
+        }
+    }
+}
+
+SCENARIO("Settings reload", "[settings][xml]")
+{
+    Config config;
+    config.instances = R"(<IntegerParameter Name="first" Size="32"/>
+                          <IntegerParameter Name="second" Size="32"/>
+                          <IntegerParameter Name="third" Size="32"/>)";
+    config.domains = domainXml("first", "1") + domainXml("second", "2");
+    ParameterFramework pfw{config};
+    REQUIRE_NOTHROW(pfw.start());
+
+    auto reload = [&pfw] {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(pfw.createCommandHandler());
+        string output;
+        CHECK(commandHandler->process("reloadSettings", {}, output));
+        return output;
+    };
+    auto parameter = [&pfw](const string &name) {
+        string value;
+        REQUIRE_NOTHROW(pfw.getParameter("/test/test/" + name, value));
+        return value;
+    };
+
+    WHEN ("The domains file did not change") {
+        THEN ("Reloading changes nothing") {
+            CHECK(reload() == "No change");
+        }
+    }
+    WHEN ("A setting changes, a domain is added and another one is removed") {
+        pfw.setDomains(domainXml("first", "10") + domainXml("third", "3"));
+
+        THEN ("Only the changes are reported") {
+            CHECK(reload() == "Updated the settings of configuration /test/first/Default\n"
+                              "Added domain third\n"
+                              "Deleted domain second");
+        }
+        THEN ("The changed settings are applied") {
+            REQUIRE_NOTHROW(pfw.reloadSettings());
+            CHECK(parameter("first") == "10");
+            CHECK(parameter("second") == "2");
+            CHECK(parameter("third") == "3");
+
+            string value;
+            CHECK_THROWS_AS(
+                pfw.getConfigurationParameter("second", "Default", "/test/test/second", value),
+                Exception);
+        }
+    }
+    WHEN ("The domains file becomes invalid") {
+        pfw.setDomains(domainXml("first", "not a number"));
+
+        THEN ("Reloading fails and the current settings are kept") {
+            CHECK_THROWS_AS(pfw.reloadSettings(), Exception);
+            string value;
+            REQUIRE_NOTHROW(
+                pfw.getConfigurationParameter("second", "Default", "/test/test/second", value));
+            CHECK(value == "2");
+        }
+    }
+}
+
+SCENARIO("Settings reload synchronization", "[settings][xml]")
+{
+    // The TEST subsystem writes each parameter to a file of this directory when synchronized
+    char directory[] = "/tmp/pfwReloadXXXXXX";
+    REQUIRE(mkdtemp(directory) != nullptr);
+    REQUIRE(setenv("PFW_RESULT", directory, 1) == 0);
+    std::ofstream(string(directory) + "/isAlive") << "true";
+    auto hardwareValue = [&directory](const string &name) {
+        std::ifstream file(string(directory) + "/" + name);
+        string value;
+        file >> value;
+        return value;
+    };
+
+    Config config;
+    config.plugins = {{"", {"test-subsystem"}}};
+    config.subsystemType = "TEST";
+    config.subsystemMapping = string("Directory:") + directory;
+    config.instances = R"(<IntegerParameter Name="first" Size="32" Mapping="Binary"/>
+                          <IntegerParameter Name="second" Size="32" Mapping="Binary"/>)";
+    config.domains = domainXml("first", "1") + domainXml("second", "2");
+    ParameterFramework pfw{config};
+    StoreLogger logger{};
+    pfw.setLogger(&logger);
+    REQUIRE_NOTHROW(pfw.start());
+    REQUIRE(hardwareValue("first") == "0x1");
+    REQUIRE(hardwareValue("second") == "0x2");
+
+    auto applications = [&logger](const string &domain) {
+        const auto &logs = logger.getLogs();
+        return std::count_if(logs.begin(), logs.end(), [&domain](const StoreLogger::Log &log) {
+            return log.msg.find("from domain '" + domain + "'") != string::npos;
+        });
+    };
+
+    WHEN ("Only the settings of one domain change before reloading") {
+        auto firstApplications = applications("first");
+        auto secondApplications = applications("second");
+        // Overwrite the hardware value to catch any synchronization of the unchanged domain
+        std::ofstream(string(directory) + "/second") << "untouched";
+        pfw.setDomains(domainXml("first", "10") + domainXml("second", "2"));
+        REQUIRE_NOTHROW(pfw.reloadSettings());
+
+        THEN ("Only the changed domain is applied and synchronized again") {
+            CHECK(applications("first") == firstApplications + 1);
+            CHECK(hardwareValue("first") == "0xa");
+            CHECK(applications("second") == secondApplications);
+            CHECK(hardwareValue("second") == "untouched");
+        }
+    }
+
+    for (auto &name : {"/first", "/second", "/isAlive"}) {
+        unlink((string(directory) + name).c_str());
+    }
+    rmdir(directory);
+}
+
+SCENARIO("Runtime checkpoint", "[settings][checkpoint]")
+{
+    Config config;
+    config.instances = R"(<IntegerParameter Name="first" Size="32"/>
+                          <IntegerParameter Name="free" Size="32"/>)";
+    config.domains = domainXml("first", "1");
+    utility::TmpFile checkpoint("");
+
+    auto parameter = [](ParameterFramework &pfw, const string &name) {
+        string value;
+        REQUIRE_NOTHROW(pfw.getParameter("/test/test/" + name, value));
+        return value;
+    };
+    auto restart = [&](StoreLogger &logger) {
+        std::unique_ptr<ParameterFramework> pfw(new ParameterFramework{config});
+        pfw->setLogger(&logger);
+        REQUIRE_NOTHROW(pfw->setRuntimeCheckpoint(checkpoint.getPath(), 0));
+        REQUIRE_NOTHROW(pfw->start());
+        return pfw;
+    };
+
+    for (uint32_t periodMs : {0u, 10u}) {
+        GIVEN ("A Pfw that checkpoints its runtime state every " + std::to_string(periodMs) +
+               " ms") {
+            std::unique_ptr<ParameterFramework> pfw(new ParameterFramework{config});
+            REQUIRE_NOTHROW(pfw->setRuntimeCheckpoint(checkpoint.getPath(), periodMs));
+            REQUIRE_NOTHROW(pfw->start());
+
+            uint32_t checkpointPeriodMs;
+            CHECK(pfw->getRuntimeCheckpoint(checkpointPeriodMs) == checkpoint.getPath());
+            CHECK(checkpointPeriodMs == periodMs);
+            CHECK_THROWS_AS(pfw->setRuntimeCheckpoint("", 0), Exception);
+
+            WHEN ("A parameter outside of any domain is set before it stops") {
+                {
+                    ElementHandle free(*pfw, "/test/test/free");
+                    REQUIRE_NOTHROW(free.setAsInteger(5));
+                }
+                if (periodMs == 0) {
+                    pfw->applyConfigurations();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10 * periodMs));
+                }
+                pfw.reset();
+
+                AND_WHEN ("A Pfw restarts from the same files") {
+                    StoreLogger logger{};
+                    auto restarted = restart(logger);
+
+                    THEN ("The runtime state is restored without applying configurations") {
+                        CHECK(logger.hasLogged("Restored runtime checkpoint"));
+                        CHECK(not logger.hasLogged("Applying configuration '"));
+                        CHECK(parameter(*restarted, "free") == "5");
+                        CHECK(parameter(*restarted, "first") == "1");
+                    }
+                }
+                AND_WHEN ("A Pfw restarts from another domains file") {
+                    config.domains = domainXml("first", "2");
+                    StoreLogger logger{};
+                    auto restarted = restart(logger);
+
+                    THEN ("The checkpoint is not used") {
+                        CHECK(logger.hasLogged("not used"));
+                        CHECK(parameter(*restarted, "free") == "0");
+                        CHECK(parameter(*restarted, "first") == "2");
+                    }
+                }
+                AND_WHEN ("A Pfw restarts with a parameter retyped to the same size") {
+                    config.instances = R"(<IntegerParameter Name="first" Size="32"/>
+                                          <IntegerParameter Name="free" Size="32" Signed="true"/>)";
+                    StoreLogger logger{};
+                    auto restarted = restart(logger);
+
+                    THEN ("The checkpoint is not used") {
+                        CHECK(logger.hasLogged("another structure"));
+                        CHECK(parameter(*restarted, "free") != "5");
+                    }
+                }
+            }
+        }
+    }
+    GIVEN ("A checkpointing Pfw whose tuning mode is turned on") {
+        {
+            ParameterFramework pfw{config};
+            REQUIRE_NOTHROW(pfw.setRuntimeCheckpoint(checkpoint.getPath(), 0));
+            REQUIRE_NOTHROW(pfw.start());
+            REQUIRE_NOTHROW(pfw.setTuningMode(true));
+        }
+        WHEN ("A Pfw restarts from the same files") {
+            StoreLogger logger{};
+            auto restarted = restart(logger);
+
+            THEN ("There is no checkpoint to restore") {
+                CHECK(logger.hasLogged("not used"));
+            }
+        }
+    }
+    GIVEN ("A Pfw checkpointing to a file URI whose tuning mode is turned on") {
+        ParameterFramework pfw{config};
+        REQUIRE_NOTHROW(pfw.setRuntimeCheckpoint("file://" + checkpoint.getPath(), 0));
+        REQUIRE_NOTHROW(pfw.start());
+        REQUIRE(std::ifstream(checkpoint.getPath()).good());
+        REQUIRE_NOTHROW(pfw.setTuningMode(true));
+
+        THEN ("The checkpoint file is removed") {
+            CHECK(!std::ifstream(checkpoint.getPath()).good());
+        }
+        // Left for the temporary file to remove
+        std::ofstream(checkpoint.getPath()).close();
+    }
+}
+
+/** @return the resident memory of the process in KiB, 0 if unknown */
+static size_t residentKiB()
+{
+    size_t sizePages = 0;
+    size_t residentPages = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> sizePages >> residentPages;
+    return residentPages * 4;
+}
+
+/** Report the resident memory growth of each framework of a structure of 2000 component types
+ * lazily loading a settings image of 2000 configurations, the frameworks being built from one
+ * model sharing the types, and the image content being shared by the frameworks of the process.
+ * Hidden from default runs, select it with the "[benchmark]" tag.
+ */
+TEST_CASE("Shared model benchmark", "[.][benchmark]")
+{
+    const size_t typeCount = 2000;
+    const size_t configurationCount = 2000;
+    const size_t frameworkCount = 4;
+
+    Config config;
+    for (size_t type = 0; type < typeCount; type++) {
+        config.components += "<ComponentType Name='t" + std::to_string(type) + "'>";
+        for (size_t parameter = 0; parameter < 8; parameter++) {
+            config.components +=
+                "<IntegerParameter Name='p" + std::to_string(parameter) + "' Size='16'/>";
+        }
+        config.components += "</ComponentType>";
+    }
+    config.instances = "<IntegerParameter Name='array' Size='8' ArrayLength='512'/>";
+    config.domains = "<ConfigurableDomain Name='Domain'><Configurations>";
+    string settings;
+    for (size_t configuration = 0; configuration < configurationCount; configuration++) {
+        string name = "c" + std::to_string(configuration);
+        config.domains += "<Configuration Name='" + name + "'><CompoundRule Type='All'/>" +
+                          "</Configuration>";
+        string values;
+        for (size_t index = 0; index < 512; index++) {
+            values += std::to_string((configuration + index) % 256) + " ";
+        }
+        settings += "<Configuration Name='" + name + "'>" +
+                    "<ConfigurableElement Path='/test/test/array'>" +
+                    "<IntegerParameter Name='array'>" + values + "</IntegerParameter>" +
+                    "</ConfigurableElement></Configuration>";
+    }
+    config.domains += "</Configurations><ConfigurableElements>" +
+                      string("<ConfigurableElement Path='/test/test/array'/>") +
+                      "</ConfigurableElements><Settings>" + settings +
+                      "</Settings></ConfigurableDomain>";
+
+    utility::TmpFile image("");
+    config.settingsImage = image.getPath();
+    {
+        ParameterFramework pfw{config};
+        REQUIRE_NOTHROW(pfw.start());
+    }
+    auto model = CParameterMgrFullConnector::createModel();
+    std::vector<std::unique_ptr<ParameterFramework>> frameworks;
+    string report = std::to_string(typeCount) + " types, " +
+                    std::to_string(configurationCount) + " configurations, resident growth:";
+
+    for (size_t framework = 0; framework < frameworkCount; framework++) {
+        size_t before = residentKiB();
+
+        frameworks.emplace_back(new ParameterFramework{config, model});
+        REQUIRE_NOTHROW(frameworks.back()->setLazySettingsLoading(true, false));
+        REQUIRE_NOTHROW(frameworks.back()->start());
+
+        report += " +" + std::to_string(residentKiB() - before) + " KiB";
+    }
+    WARN(report);
+}
+
+/** @return the value in KiB of a memory field of /proc/self/status, 0 if unknown */
+static size_t statusKiB(const string &field)
+{
+    std::ifstream status("/proc/self/status");
+    string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size() + 1, field + ":") == 0) {
+            return std::stoul(line.substr(field.size() + 1));
+        }
+    }
+    return 0;
+}
+
+/** Run a task in a child process, whose high-water mark is reset once it is ready
+ *
+ * @param[in] prepare what to do before measuring, in the child process
+ * @param[in] task what to measure, in the child process
+ * @return the growth of the peak resident memory while running the task in KiB, 0 if unknown
+ */
+static size_t peakGrowthKiB(const std::function<void()> &prepare,
+                            const std::function<void()> &task)
+{
+    int fds[2];
+    REQUIRE(pipe(fds) == 0);
+    pid_t child = fork();
+    REQUIRE(child != -1);
+
+    if (child == 0) {
+        // No test macro here: the child only reports its measure to the parent
+        close(fds[0]);
+        size_t growth = 0;
+        try {
+            prepare();
+            // Make the high-water mark the current resident memory
+            std::ofstream("/proc/self/clear_refs") << "5";
+            size_t before = statusKiB("VmHWM");
+            task();
+            growth = statusKiB("VmHWM") - before;
+        } catch (...) {
+        }
+        ssize_t written = write(fds[1], &growth, sizeof(growth));
+        _exit(written == sizeof(growth) ? 0 : 1);
+    }
+    close(fds[1]);
+    size_t growth = 0;
+    CHECK(read(fds[0], &growth, sizeof(growth)) == sizeof(growth));
+    close(fds[0]);
+    int status;
+    CHECK(waitpid(child, &status, 0) == child);
+    return growth;
+}
+
+/** Report the time of importing 2000 domains from their XML file at start, and the peak RSS
+ * growth of reading them again, measured in a fresh process. For reference, the peak RSS growth
+ * of parsing the same domains into a libxml2 document is reported too.
+ * Hidden from default runs, select it with the "[benchmark]" tag.
+ */
+TEST_CASE("Domains import benchmark", "[.][benchmark]")
+{
+    const size_t domainCount = 2000;
+
+    Config config;
+    for (size_t domain = 0; domain < domainCount; domain++) {
+        string name = "p" + std::to_string(domain);
+        config.instances += "<IntegerParameter Name='" + name + "' Size='32'/>";
+        config.domains += domainXml(name, std::to_string(domain));
+    }
+    ParameterFramework pfw{config};
+    REQUIRE_NOTHROW(pfw.start());
+
+    string profile = "\n" + pfw.getStartupProfile();
+    auto settings = profile.find("\nSettings: ");
+    REQUIRE(settings != string::npos);
+    auto times = profile.find(", peak RSS", settings);
+    REQUIRE(times != string::npos);
+
+    std::unique_ptr<ParameterFramework> child;
+    size_t settingsGrowth = peakGrowthKiB(
+        [&] {
+            child.reset(new ParameterFramework{config});
+            child->start();
+        },
+        [&] { child->reloadSettings(); });
+
+    string xml = "<ConfigurableDomains>" + config.domains + "</ConfigurableDomains>";
+    size_t documentGrowth = peakGrowthKiB([] {}, [&] {
+        xmlFreeDoc(xmlReadMemory(xml.data(), static_cast<int>(xml.size()), "", NULL, 0));
+    });
+
+    WARN(std::to_string(domainCount) + " domains of " + std::to_string(xml.size() / 1024) +
+         " KiB of XML, " + profile.substr(settings + 1, times - settings - 1) +
+         ", peak RSS when reloaded +" + std::to_string(settingsGrowth) +
+         " KiB, peak RSS of their libxml2 document +" + std::to_string(documentGrowth) + " KiB");
+}
+}
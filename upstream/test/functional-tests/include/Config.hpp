@@ -59,8 +59,18 @@ struct Config
      * SystemClass/Subsystem[name=test]/InstanceDefinition xml node.
      */
     std::string instances;
+    /** Content of the configuration SystemClass xml node following the test subsystem,
+     * typically SubsystemInclude nodes. */
+    std::string subsystemIncludes;
     /** Content of the configuartion ConfigurableDomains xml node. */
     std::string domains;
+    /** Path of the structure image, none if empty. */
+    std::string structureImage;
+    /** Path of an existing structure file to use instead of the one generated from the fields
+     * above, none if empty. */
+    std::string structurePath;
+    /** Path of the settings image, none if empty. */
+    std::string settingsImage;
     /** Content of the configuration SubsystemPlugins xml node. */
     std::string components;
 
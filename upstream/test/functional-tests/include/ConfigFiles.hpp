@@ -47,16 +47,35 @@ public:
               format(mStructureTemplate, {{"type", config.subsystemType},
                                           {"instances", config.instances},
                                           {"components", config.components},
-                                          {"subsystemMapping", config.subsystemMapping}})),
+                                          {"subsystemMapping", config.subsystemMapping},
+                                          {"subsystemIncludes", config.subsystemIncludes}})),
           mDomainsFile(format(mDomainsTemplate, {{"domains", config.domains}})),
-          mConfigFile(format(mConfigTemplate, {{"structurePath", mStructureFile.getPath()},
+          mStructurePath(config.structurePath.empty() ? mStructureFile.getPath()
+                                                      : config.structurePath),
+          mConfigFile(format(mConfigTemplate, {{"structurePath", mStructurePath},
                                                {"domainsPath", mDomainsFile.getPath()},
+                                               {"structureImage",
+                                                toXml("Structure", config.structureImage)},
+                                               {"settingsImage",
+                                                toXml("Settings", config.settingsImage)},
                                                {"plugins", toXml(config.plugins)}}))
     {
     }
 
     std::string getPath() { return mConfigFile.getPath(); }
 
+    /** Path of the structure file, which may be shared with other configurations. */
+    std::string getStructurePath() { return mStructurePath; }
+
+    /** Replace the domains of the domains file, for example to reload it. */
+    void setDomains(const std::string &domains)
+    {
+        std::ofstream file(mDomainsFile.getPath());
+        file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        file << format(mDomainsTemplate, {{"domains", domains}});
+        file.close();
+    }
+
 private:
     std::string toXml(const Config::Plugin::Collection &plugins)
     {
@@ -74,6 +93,14 @@ private:
         return pluginsXml;
     }
 
+    std::string toXml(const std::string &imageKind, const std::string &imagePath)
+    {
+        if (imagePath.empty()) {
+            return "";
+        }
+        return "<" + imageKind + "ImageFileLocation Path='" + imagePath + "'/>";
+    }
+
     std::string format(std::string format, std::map<std::string, std::string> subs)
     {
         for (auto &sub : subs) {
@@ -91,13 +118,16 @@ private:
     }
 
     const char *mConfigTemplate = R"(<?xml version='1.0' encoding='UTF-8'?>
-        <ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'>
+        <ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'
+                                         ServerPort='1'>
             <SubsystemPlugins>
                 {plugins}
             </SubsystemPlugins>
             <StructureDescriptionFileLocation Path='{structurePath}'/>
+            {structureImage}
             <SettingsConfiguration>
                 <ConfigurableDomainsFileLocation Path='{domainsPath}'/>
+                {settingsImage}
             </SettingsConfiguration>
         </ParameterFrameworkConfiguration>
      )";
@@ -111,6 +141,7 @@ private:
                     {instances}
                 </InstanceDefinition>
             </Subsystem>
+            {subsystemIncludes}
         </SystemClass>
     )";
     const char *mDomainsTemplate = R"(<?xml version='1.0' encoding='UTF-8'?>
@@ -121,6 +152,7 @@ private:
 
     utility::TmpFile mStructureFile;
     utility::TmpFile mDomainsFile;
+    std::string mStructurePath;
     utility::TmpFile mConfigFile;
 };
 
@@ -62,6 +62,9 @@ public:
      */
     size_t getSize() const { return EH::getSize(); }
 
+    /** @return the wrapped handle, eg to add its accesses to a ParameterBatch. */
+    const EH &unwrap() const { return *this; }
+
     std::string getMappingData(const std::string &key)
     {
         std::string value;
@@ -98,6 +101,10 @@ public:
         mayFailCall(&EH::getAsSignedIntegerArray, value);
     }
 
+    using EH::ChangeCallback;
+    using EH::subscribeToChanges;
+    using EH::unsubscribeFromChanges;
+
     std::string getStructureAsXML() const { return mayFailGet(&EH::getStructureAsXML); }
 
     std::string getAsXML() const { return mayFailGet(&EH::getAsXML); }
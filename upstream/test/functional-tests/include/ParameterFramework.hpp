@@ -68,8 +68,22 @@ public:
         setForceNoRemoteInterface(true);
     }
 
+    /** Build a framework sharing the immutable parts of the others of a model,
+     * see CParameterMgrPlatformConnector::createModel */
+    ParameterFramework(const Config &config, std::shared_ptr<CParameterMgrModel> model)
+        : ConfigFiles(config), FailureWrapper(getPath(), model)
+    {
+        setForceNoRemoteInterface(true);
+    }
+
     void start() { mayFailCall(&PF::start); }
 
+    /** Wrap PF::reloadSettings to throw an exception on failure. */
+    void reloadSettings() { mayFailCall(&PPF::reloadSettings); }
+
+    using ConfigFiles::setDomains;
+    using ConfigFiles::getStructurePath;
+
     /** @name Forwarded methods
      * Forward those methods without modification as there are ergonomic and
      * can not fail (no failure to throw).
@@ -87,6 +101,17 @@ public:
     using PF::isTuningModeOn;
     using PF::isAutoSyncOn;
     using PF::setLogger;
+    using PF::setSettingsCompression;
+    using PF::getSettingsCompression;
+    using PF::getLazySettingsLoading;
+    using PF::getBackSynchronizationConcurrency;
+    using PF::getMappingConcurrency;
+    using PF::getRuntimeCheckpoint;
+    using PF::getStartupProfile;
+    using PF::setStartupProfileLogging;
+    using PF::getStartupProfileLogging;
+    using PF::getEpoch;
+    using PF::getChangedSince;
     using PF::createCommandHandler;
     /** @} */
 
@@ -102,6 +127,30 @@ public:
         mayFailCall(&PPF::setFailureOnFailedSettingsLoad, fail);
     }
 
+    /** Wrap PF::setLazySettingsLoading to throw an exception on failure. */
+    void setLazySettingsLoading(bool lazy, bool warmUp)
+    {
+        mayFailCall(&PPF::setLazySettingsLoading, lazy, warmUp);
+    }
+
+    /** Wrap PF::setBackSynchronizationConcurrency to throw an exception on failure. */
+    void setBackSynchronizationConcurrency(size_t concurrency)
+    {
+        mayFailCall(&PPF::setBackSynchronizationConcurrency, concurrency);
+    }
+
+    /** Wrap PF::setMappingConcurrency to throw an exception on failure. */
+    void setMappingConcurrency(size_t concurrency)
+    {
+        mayFailCall(&PPF::setMappingConcurrency, concurrency);
+    }
+
+    /** Wrap PF::setRuntimeCheckpoint to throw an exception on failure. */
+    void setRuntimeCheckpoint(const std::string &path, uint32_t periodMs)
+    {
+        mayFailCall(&PPF::setRuntimeCheckpoint, path, periodMs);
+    }
+
     /** Wrap PF::setFailureOnMissingSubsystem to throw an exception on failure. */
     void setFailureOnMissingSubsystem(bool fail)
     {
@@ -155,6 +204,32 @@ public:
         mayFailCall(&PF::accessConfigurationValue, domain, configuration, path, value, false);
     }
 
+    /** Wrap PF::saveConfiguration to throw an exception on failure. */
+    void saveConfiguration(const std::string &domain, const std::string &configuration)
+    {
+        mayFailCall(&PF::saveConfiguration, domain, configuration);
+    }
+
+    /** Wrap PF::exportDomainsXml to throw an exception on failure. */
+    void exportDomainsXml(std::string &xmlDest, bool withSettings, bool toFile) const
+    {
+        mayFailCall(&PF::exportDomainsXml, xmlDest, withSettings, toFile);
+    }
+
+    /** Wrap PF::exportSettingsImage to throw an exception on failure. */
+    void exportSettingsImage(const std::string &path)
+    {
+        mayFailCall(&PF::exportSettingsImage, path);
+    }
+
+    /** Wrap PPF::createScalarHandle to throw an exception on failure. */
+    template <class T>
+    std::unique_ptr<ScalarHandle<T>> createScalarHandle(const std::string &path) const
+    {
+        return std::unique_ptr<ScalarHandle<T>>{
+            mayFailCall(&PPF::template createScalarHandle<T>, path)};
+    }
+
 private:
     /** Create an unwrapped element handle.
      *
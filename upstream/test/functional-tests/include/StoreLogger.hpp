@@ -81,6 +81,14 @@ public:
             [&pattern](const Log &log) { return log.msg.find(pattern) == std::string::npos; });
     }
 
+    /** @return true if a log containing the given pattern was stored */
+    bool hasLogged(const std::string &pattern) const
+    {
+        return std::any_of(logs.begin(), logs.end(), [&pattern](const Log &log) {
+            return log.msg.find(pattern) != std::string::npos;
+        });
+    }
+
 private:
     template <class Predicate>
     Logs filter(Predicate predicate) const
@@ -94,7 +102,7 @@ private:
 };
 
 /** Overload input stream operator to pretty print a StoreLogger::Log::Level. */
-std::ostream &operator<<(std::ostream &os, const StoreLogger::Log::Level &level)
+inline std::ostream &operator<<(std::ostream &os, const StoreLogger::Log::Level &level)
 {
     auto levelStr = "UNREACHABLE";
     using L = StoreLogger::Log::Level;
@@ -110,7 +118,7 @@ std::ostream &operator<<(std::ostream &os, const StoreLogger::Log::Level &level)
 }
 
 /** Overload input stream operator to pretty print a StoreLogger::Log. */
-std::ostream &operator<<(std::ostream &os, const StoreLogger::Log &log)
+inline std::ostream &operator<<(std::ostream &os, const StoreLogger::Log &log)
 {
     return os << log.level << log.msg << std::endl;
 }
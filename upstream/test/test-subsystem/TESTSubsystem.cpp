@@ -64,6 +64,12 @@ bool CTESTSubsystem::isAlive() const
     return read(std::string(gacFwNamePropName) + "/isAlive") == "true";
 }
 
+// Concurrent synchronization and mapping
+bool CTESTSubsystem::isThreadSafe() const
+{
+    return true;
+}
+
 // Resynchronization after subsystem restart needed
 bool CTESTSubsystem::needResync(bool bClear)
 {
@@ -40,6 +40,8 @@ public:
     virtual bool isAlive() const;
     // Resynchronization after subsystem restart needed
     virtual bool needResync(bool bClear);
+    // Objects only access their own file, health files are only read while synchronizing
+    bool isThreadSafe() const override;
 
 private:
     // Read boolean from file
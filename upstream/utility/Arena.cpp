@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace utility
+{
+
+void *Arena::allocate(size_t size, size_t alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    uintptr_t next = reinterpret_cast<uintptr_t>(mNext);
+    uintptr_t aligned = (next + alignment - 1) & ~(uintptr_t(alignment) - 1);
+
+    if (mNext == nullptr || aligned + size > reinterpret_cast<uintptr_t>(mEnd)) {
+
+        // Oversized allocations get a block of their own
+        size_t blockSize = std::max(mBlockSize, size + alignment);
+        mBlocks.push_back({std::unique_ptr<char[]>(new char[blockSize]), blockSize});
+        mNext = mBlocks.back().data.get();
+        mEnd = mNext + blockSize;
+
+        next = reinterpret_cast<uintptr_t>(mNext);
+        aligned = (next + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    }
+    mNext += aligned - next + size;
+
+    return reinterpret_cast<void *>(aligned);
+}
+
+void Arena::clear()
+{
+    mBlocks.clear();
+    mNext = nullptr;
+    mEnd = nullptr;
+}
+
+size_t Arena::getCapacity() const
+{
+    size_t capacity = 0;
+    for (const auto &block : mBlocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+} // namespace utility
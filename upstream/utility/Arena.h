@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace utility
+{
+
+/** Memory arena: objects allocated from it are freed all at once with the arena.
+ *
+ * Allocations are carved out of large blocks one after the other, so that objects allocated in
+ * sequence are contiguous in memory. Freeing a single allocation is not supported; destructors of
+ * the objects are not run by the arena.
+ *
+ * An arena is not thread-safe.
+ */
+class Arena : private NonCopyable
+{
+public:
+    /** @param[in] blockSize the size of the blocks allocations are carved out of */
+    explicit Arena(size_t blockSize = 64 * 1024) : mBlockSize(blockSize) {}
+
+    /** Allocate memory.
+     *
+     * @param[in] size the size to allocate
+     * @param[in] alignment the alignment of the allocation, a power of two
+     * @return the allocated memory, valid until the arena is cleared or destroyed
+     */
+    void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /** Free all allocations at once. */
+    void clear();
+
+    /** @return the memory held by the arena, in bytes */
+    size_t getCapacity() const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    const size_t mBlockSize;
+    std::vector<Block> mBlocks;
+    /** Free space of the last block */
+    char *mNext{nullptr};
+    char *mEnd{nullptr};
+};
+
+} // namespace utility
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BytesDiff.h"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BYTES_DIFF_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define BYTES_DIFF_NEON
+#include <arm_neon.h>
+#endif
+
+namespace utility
+{
+
+namespace
+{
+
+/** Length of the longest common prefix of two memory ranges where bytes are all equal
+ * (or all different, if equal is false).
+ *
+ * Vector loops only locate the first block holding a byte that breaks the prefix,
+ * scalar loops then locate the byte itself.
+ */
+template <bool equal>
+size_t prefixLength(const uint8_t *first, const uint8_t *second, size_t size)
+{
+    size_t index = 0;
+
+#if defined(__AVX2__)
+    const uint32_t avx2Prefix = equal ? 0xFFFFFFFF : 0;
+    for (; index + 32 <= size; index += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + index));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(second + index));
+        if (static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))) != avx2Prefix) {
+            break;
+        }
+    }
+#endif
+
+#if defined(BYTES_DIFF_SSE2)
+    const int sse2Prefix = equal ? 0xFFFF : 0;
+    for (; index + 16 <= size; index += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + index));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second + index));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != sse2Prefix) {
+            break;
+        }
+    }
+#elif defined(BYTES_DIFF_NEON)
+    for (; index + 16 <= size; index += 16) {
+        uint8x16_t comparison = vceqq_u8(vld1q_u8(first + index), vld1q_u8(second + index));
+        if (equal ? vminvq_u8(comparison) != 0xFF : vmaxvq_u8(comparison) != 0) {
+            break;
+        }
+    }
+#endif
+
+    if (equal) {
+        for (; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t)) {
+            uint64_t a;
+            uint64_t b;
+            std::memcpy(&a, first + index, sizeof(a));
+            std::memcpy(&b, second + index, sizeof(b));
+            if (a != b) {
+                break;
+            }
+        }
+    }
+    for (; index < size && (first[index] == second[index]) == equal; ++index) {
+    }
+    return index;
+}
+
+} // namespace
+
+bool nextDiffSpan(const uint8_t *first, const uint8_t *second, size_t size, size_t from,
+                  BytesSpan &span)
+{
+    size_t index = from + prefixLength<true>(first + from, second + from, size - from);
+
+    if (index == size) {
+        return false;
+    }
+    span = {index, prefixLength<false>(first + index, second + index, size - index)};
+    return true;
+}
+
+std::vector<BytesSpan> diffBytes(const uint8_t *first, const uint8_t *second, size_t size)
+{
+    std::vector<BytesSpan> spans;
+    BytesSpan span;
+
+    for (size_t index = 0; nextDiffSpan(first, second, size, index, span);
+         index = span.offset + span.size) {
+        spans.push_back(span);
+    }
+    return spans;
+}
+
+} // namespace utility
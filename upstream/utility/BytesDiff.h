@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace utility
+{
+
+/** Range of bytes, relative to the start of a compared memory range */
+struct BytesSpan
+{
+    size_t offset;
+    size_t size;
+
+    bool operator==(const BytesSpan &other) const
+    {
+        return offset == other.offset && size == other.size;
+    }
+};
+
+/** List the spans of bytes that differ between two memory ranges of the same size
+ *
+ * Comparison is vectorized (SSE2, AVX2 or NEON) when the target supports it.
+ *
+ * @param[in] first the first memory range
+ * @param[in] second the second memory range
+ * @param[in] size the size of both ranges
+ * @return the maximal spans of differing bytes, in increasing offset order
+ */
+std::vector<BytesSpan> diffBytes(const uint8_t *first, const uint8_t *second, size_t size);
+
+/** Find the next span of bytes that differ between two memory ranges, without allocating
+ *
+ * @param[in] first the first memory range
+ * @param[in] second the second memory range
+ * @param[in] size the size of both ranges
+ * @param[in] from the offset to start the search at
+ * @param[out] span the maximal span of differing bytes found
+ * @return true if a differing span was found at or after from, false otherwise
+ */
+bool nextDiffSpan(const uint8_t *first, const uint8_t *second, size_t size, size_t from,
+                  BytesSpan &span);
+
+} // namespace utility
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Compression.h"
+
+#include <algorithm>
+#include <limits>
+
+/* Compressed data is a list of sequences, each made of:
+ *  - a token byte: literal count in the high nibble, match length minus minMatch in the
+ *    low nibble. A nibble set to 15 is followed by extra bytes added to the count, up to
+ *    and including the first byte that is not 255;
+ *  - the literal bytes;
+ *  - the match offset on 2 little endian bytes, backward from the current position.
+ * The last sequence only holds literals, possibly none.
+ */
+
+namespace utility
+{
+namespace compression
+{
+
+namespace
+{
+
+const size_t minMatch = 4;
+const size_t maxOffset = std::numeric_limits<uint16_t>::max();
+const size_t nibbleMax = 15;
+const unsigned hashBits = 12;
+
+uint32_t read32(const std::vector<uint8_t> &data, size_t position)
+{
+    return static_cast<uint32_t>(data[position]) | static_cast<uint32_t>(data[position + 1]) << 8 |
+           static_cast<uint32_t>(data[position + 2]) << 16 |
+           static_cast<uint32_t>(data[position + 3]) << 24;
+}
+
+size_t hash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+void writeLength(std::vector<uint8_t> &output, size_t length)
+{
+    for (; length >= 255; length -= 255) {
+        output.push_back(255);
+    }
+    output.push_back(static_cast<uint8_t>(length));
+}
+
+bool readLength(const std::vector<uint8_t> &input, size_t &position, size_t &length)
+{
+    uint8_t byte;
+    do {
+        if (position >= input.size()) {
+            return false;
+        }
+        byte = input[position++];
+        length += byte;
+    } while (byte == 255);
+
+    return true;
+}
+
+/** Emit a sequence, without match if matchLength is 0 */
+void writeSequence(std::vector<uint8_t> &output, const std::vector<uint8_t> &input,
+                   size_t literalStart, size_t literalLength, size_t offset, size_t matchLength)
+{
+    size_t matchCode = matchLength != 0 ? matchLength - minMatch : 0;
+    size_t literalNibble = std::min(literalLength, nibbleMax);
+    size_t matchNibble = std::min(matchCode, nibbleMax);
+
+    output.push_back(static_cast<uint8_t>(literalNibble << 4 | matchNibble));
+    if (literalNibble == nibbleMax) {
+        writeLength(output, literalLength - nibbleMax);
+    }
+    output.insert(end(output), begin(input) + literalStart,
+                  begin(input) + literalStart + literalLength);
+
+    if (matchLength == 0) {
+        return;
+    }
+    output.push_back(static_cast<uint8_t>(offset));
+    output.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchNibble == nibbleMax) {
+        writeLength(output, matchCode - nibbleMax);
+    }
+}
+
+} // namespace
+
+std::vector<uint8_t> compress(const std::vector<uint8_t> &input)
+{
+    const size_t none = std::numeric_limits<size_t>::max();
+    std::vector<size_t> lastPositions(1 << hashBits, none);
+    std::vector<uint8_t> output;
+    output.reserve(input.size() / 2);
+
+    size_t anchor = 0;
+    size_t position = 0;
+
+    while (position + minMatch <= input.size()) {
+
+        uint32_t sequence = read32(input, position);
+        size_t &lastPosition = lastPositions[hash(sequence)];
+        size_t candidate = lastPosition;
+        lastPosition = position;
+
+        if (candidate == none || position - candidate > maxOffset ||
+            read32(input, candidate) != sequence) {
+            ++position;
+            continue;
+        }
+        size_t length = minMatch;
+        while (position + length < input.size() &&
+               input[candidate + length] == input[position + length]) {
+            ++length;
+        }
+        writeSequence(output, input, anchor, position - anchor, position - candidate, length);
+
+        position += length;
+        anchor = position;
+    }
+    writeSequence(output, input, anchor, input.size() - anchor, 0, 0);
+
+    return output;
+}
+
+bool decompress(const std::vector<uint8_t> &input, size_t size, std::vector<uint8_t> &output)
+{
+    output.clear();
+    output.reserve(size);
+
+    size_t position = 0;
+
+    while (position < input.size()) {
+
+        uint8_t token = input[position++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == nibbleMax && !readLength(input, position, literalLength)) {
+            return false;
+        }
+        if (literalLength > input.size() - position || literalLength > size - output.size()) {
+            return false;
+        }
+        output.insert(end(output), begin(input) + position,
+                      begin(input) + position + literalLength);
+        position += literalLength;
+
+        if (output.size() == size) {
+            // The last sequence has no match
+            return position == input.size();
+        }
+
+        if (input.size() - position < 2) {
+            return false;
+        }
+        size_t offset = input[position] | static_cast<size_t>(input[position + 1]) << 8;
+        position += 2;
+
+        size_t matchLength = (token & nibbleMax);
+        if (matchLength == nibbleMax && !readLength(input, position, matchLength)) {
+            return false;
+        }
+        matchLength += minMatch;
+
+        if (offset == 0 || offset > output.size() || matchLength > size - output.size()) {
+            return false;
+        }
+        // Matches may overlap with the bytes they produce, copy byte per byte
+        for (size_t from = output.size() - offset; matchLength != 0; --matchLength) {
+            output.push_back(output[from++]);
+        }
+    }
+    return false;
+}
+
+} // namespace compression
+} // namespace utility
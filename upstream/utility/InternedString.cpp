@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "InternedString.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace utility
+{
+
+namespace
+{
+/** Interned strings, looked up without locking
+ *
+ * Lookups walk an index whose chains are only ever prepended to, and whose nodes are immutable
+ * once published, so that a reader never needs the lock. Interning a new string takes the lock,
+ * and growing the index publishes a fresh bucket array. The replaced arrays and nodes are kept,
+ * as readers may still walk them: like the strings, they are never freed.
+ */
+class Table
+{
+public:
+    Table() { publish(1024); }
+
+    /** @return the interned string equal to str, nullptr if none */
+    const std::string *find(const std::string &str, size_t hash) const
+    {
+        const Buckets *buckets = mBuckets.load(std::memory_order_acquire);
+        const Node *node = buckets->heads[hash % buckets->count].load(std::memory_order_acquire);
+
+        for (; node != nullptr; node = node->next) {
+            if (node->hash == hash && *node->string == str) {
+                return node->string;
+            }
+        }
+        return nullptr;
+    }
+
+    const std::string *intern(const std::string &str)
+    {
+        size_t hash = std::hash<std::string>()(str);
+        const std::string *interned = find(str, hash);
+        if (interned != nullptr) {
+            return interned;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // May have been interned since the lookup
+        auto inserted = mStrings.insert(str);
+        if (!inserted.second) {
+            return &*inserted.first;
+        }
+        if (mStrings.size() > mBuckets.load(std::memory_order_relaxed)->count) {
+            // The new string gets indexed with the others
+            publish(mStrings.size() * 2);
+        } else {
+            index(*mBuckets.load(std::memory_order_relaxed), &*inserted.first, hash);
+        }
+        return &*inserted.first;
+    }
+
+    InternedString::Usage getUsage()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        InternedString::Usage usage{mStrings.size(), 0};
+        for (auto &string : mStrings) {
+            usage.stringBytes += string.size();
+        }
+        return usage;
+    }
+
+private:
+    struct Node
+    {
+        const std::string *string;
+        size_t hash;
+        const Node *next;
+    };
+    struct Buckets
+    {
+        explicit Buckets(size_t size) : count(size), heads(new std::atomic<const Node *>[size])
+        {
+            for (size_t bucket = 0; bucket < count; bucket++) {
+                heads[bucket].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        const size_t count;
+        std::unique_ptr<std::atomic<const Node *>[]> heads;
+    };
+
+    /** Prepend a string to its chain, must be called with the lock held */
+    void index(Buckets &buckets, const std::string *string, size_t hash)
+    {
+        std::atomic<const Node *> &head = buckets.heads[hash % buckets.count];
+        mNodes.push_back({string, hash, head.load(std::memory_order_relaxed)});
+        head.store(&mNodes.back(), std::memory_order_release);
+    }
+
+    /** Index all the strings in a new bucket array then make it visible to the readers, must be
+     * called with the lock held
+     */
+    void publish(size_t count)
+    {
+        mBucketArrays.emplace_back(new Buckets(count));
+        Buckets &buckets = *mBucketArrays.back();
+        for (auto &string : mStrings) {
+            index(buckets, &string, std::hash<std::string>()(string));
+        }
+        mBuckets.store(&buckets, std::memory_order_release);
+    }
+
+    std::mutex mMutex;
+    // Elements of an unordered_set are never moved: their address is a stable handle
+    std::unordered_set<std::string> mStrings;
+    // Nor are the elements of a deque only appended to
+    std::deque<Node> mNodes;
+    // All the bucket arrays ever published, the last one being the current one
+    std::vector<std::unique_ptr<Buckets>> mBucketArrays;
+    std::atomic<Buckets *> mBuckets;
+};
+
+Table &table()
+{
+    // Never destroyed: interned strings may be used by static objects until exit
+    static Table *table = new Table;
+    return *table;
+}
+} // namespace
+
+InternedString::InternedString(const std::string &str) : mString(&emptyString())
+{
+    if (str.empty()) {
+        return;
+    }
+    mString = table().intern(str);
+}
+
+bool InternedString::find(const std::string &str, InternedString &interned)
+{
+    if (str.empty()) {
+        interned = InternedString();
+        return true;
+    }
+    const std::string *found = table().find(str, std::hash<std::string>()(str));
+    if (found == nullptr) {
+        return false;
+    }
+    interned.mString = found;
+    return true;
+}
+
+InternedString::Usage InternedString::getUsage()
+{
+    return table().getUsage();
+}
+
+const std::string &InternedString::emptyString()
+{
+    static const std::string *empty = new std::string;
+    return *empty;
+}
+
+} // namespace utility
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace utility
+{
+
+/** Handle on a string stored once per process.
+ *
+ * Equal interned strings share the same storage: copying or comparing interned strings only
+ * copies or compares a pointer. Interned strings are never freed, they are meant for strings
+ * repeated many times but of limited variety, such as element names.
+ *
+ * Interning is thread-safe, and finding an already interned string does not lock.
+ */
+class InternedString
+{
+public:
+    /** The empty string. */
+    InternedString() : mString(&emptyString()) {}
+
+    /** Intern a string.
+     *
+     * @param[in] str the string to intern
+     */
+    explicit InternedString(const std::string &str);
+
+    /** Find the interned string equal to a string, without interning it.
+     *
+     * @param[in] str the string to look for
+     * @param[out] interned the interned string if found, unchanged otherwise
+     * @return true if found, false if that string was never interned
+     */
+    static bool find(const std::string &str, InternedString &interned);
+
+    const std::string &str() const { return *mString; }
+    bool empty() const { return mString->empty(); }
+
+    bool operator==(const InternedString &other) const { return mString == other.mString; }
+    bool operator!=(const InternedString &other) const { return mString != other.mString; }
+
+    /** Memory held by the interned strings */
+    struct Usage
+    {
+        size_t count;       /**< number of distinct interned strings */
+        size_t stringBytes; /**< size of their characters */
+    };
+    static Usage getUsage();
+
+private:
+    static const std::string &emptyString();
+
+    const std::string *mString;
+};
+
+} // namespace utility
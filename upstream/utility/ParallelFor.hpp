@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+namespace utility
+{
+
+/** Call a task for each index of [0, count), from up to concurrency threads.
+ *
+ * The calling thread takes part in the work: no thread is started if concurrency is 1.
+ * Indexes are handed out in increasing order to the first available thread.
+ *
+ * @param[in] count the number of indexes
+ * @param[in] concurrency the maximum number of threads running the tasks
+ * @param[in] task callable taking a size_t index, called once per index
+ */
+template <class Task>
+void parallelFor(size_t count, size_t concurrency, Task task)
+{
+    std::atomic<size_t> next{0};
+    auto work = [&] {
+        for (size_t index = next++; index < count; index = next++) {
+            task(index);
+        }
+    };
+
+    std::vector<std::future<void>> workers;
+    for (size_t worker = 1; worker < std::min(concurrency, count); worker++) {
+        workers.push_back(std::async(std::launch::async, work));
+    }
+    work();
+    for (auto &worker : workers) {
+        worker.get();
+    }
+}
+
+} // namespace utility
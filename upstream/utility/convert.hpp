@@ -31,10 +31,14 @@
 #pragma once
 
 #include <limits>
+#include <locale>
 #include <sstream>
+#include <iomanip>
 #include <string>
 #include <stdint.h>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <type_traits>
 
 /* details namespace is here to hide implementation details to header end user. It
@@ -114,41 +118,186 @@ struct ConvertionAllowedVia<signed char, int> : std::true_type
 {
 };
 
+/* White spaces rejected anywhere in a converted string */
+static inline bool isRejectedSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\r';
+}
+
+static inline bool isDecimalDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/* Value of an hexadecimal digit, 16 for any other character */
+static inline unsigned int digitValue(char c)
+{
+    if (isDecimalDigit(c)) {
+        return static_cast<unsigned int>(c - '0');
+    }
+    if (c >= 'a' && c <= 'f') {
+        return static_cast<unsigned int>(c - 'a' + 10);
+    }
+    if (c >= 'A' && c <= 'F') {
+        return static_cast<unsigned int>(c - 'A' + 10);
+    }
+    return 16;
+}
+
+/* Parse [begin, end) as an integer, accepting what the stream extraction would:
+ * - in decimal, an optional sign followed by digits,
+ * - in hexadecimal, the "0x" prefix followed by digits,
+ * out of range values being rejected. */
 template <typename T>
-static inline bool convertTo(const std::string &str, T &result)
+static inline bool parseNumber(const std::string & /*str*/, const char *it, const char *end,
+                               bool hexadecimal, T &result, std::true_type /*isInteger*/)
 {
-    /* Check that conversion to that type is allowed.
-     * If this fails, this means that this template was not intended to be used
-     * with this type, thus that the result is undefined. */
-    static_assert(ConvertionAllowed<T>::value, "convertTo does not support this conversion");
+    typedef unsigned long long Magnitude;
 
-    if (str.find_first_of(std::string("\r\n\t\v ")) != std::string::npos) {
-        return false;
+    unsigned int base = 10;
+    bool negative = false;
+
+    if (hexadecimal) {
+
+        // Skip the "0x" prefix
+        base = 16;
+        it += 2;
+    } else if (it != end && (*it == '+' || *it == '-')) {
+
+        negative = *it++ == '-';
     }
 
-    /* Check for a '-' in string. If type is unsigned and a - is found, the
-     * parsing fails. This is made necessary because "-1" is read as 65535 for
-     * uint16_t, for example */
-    if (str.find("-") != std::string::npos && !std::numeric_limits<T>::is_signed) {
+    // Signed types accept down to min, which is -(max + 1)
+    const Magnitude max = static_cast<Magnitude>(std::numeric_limits<T>::max()) +
+                          (negative && std::numeric_limits<T>::is_signed ? 1 : 0);
+    Magnitude magnitude = 0;
+    bool foundDigit = false;
+
+    for (; it != end; ++it) {
+        unsigned int digit = digitValue(*it);
+        if (digit >= base) {
+            break;
+        }
+        if (magnitude > (max - digit) / base) {
+            return false;
+        }
+        magnitude = magnitude * base + digit;
+        foundDigit = true;
+    }
+    if (it != end || !foundDigit) {
         return false;
     }
 
-    std::stringstream ss(str);
+    if (negative && magnitude != 0) {
+        result = static_cast<T>(-static_cast<T>(magnitude - 1) - 1);
+    } else {
+        result = static_cast<T>(magnitude);
+    }
+    return true;
+}
+
+static inline void parseFloatingPoint(const char *str, char **end, float &result)
+{
+    result = std::strtof(str, end);
+}
 
-    /* Sadly, the stream conversion does not handle hexadecimal format, thus
-     * check is done manually */
-    if (str.substr(0, 2) == "0x") {
-        if (std::numeric_limits<T>::is_integer) {
-            ss >> std::hex >> result;
+static inline void parseFloatingPoint(const char *str, char **end, double &result)
+{
+    result = std::strtod(str, end);
+}
+
+/* Parse [begin, end) as a floating point number, accepting what the stream extraction would:
+ * an optional sign, digits with at most one decimal point, then an optional exponent.
+ * The validated number is then converted by strtod, as the stream extraction does. */
+template <typename T>
+static inline bool parseNumber(const std::string &str, const char *it, const char *end,
+                               bool /*hexadecimal*/, T &result, std::false_type /*isInteger*/)
+{
+    const char *number = it;
+    bool foundDigit = false;
+    bool foundPoint = false;
+
+    if (it != end && (*it == '+' || *it == '-')) {
+        ++it;
+    }
+    for (; it != end; ++it) {
+        if (isDecimalDigit(*it)) {
+            foundDigit = true;
+        } else if (*it == '.' && !foundPoint) {
+            foundPoint = true;
         } else {
-            /* Conversion undefined for non integers */
+            break;
+        }
+    }
+    if (!foundDigit) {
+        return false;
+    }
+    if (it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        if (it != end && (*it == '+' || *it == '-')) {
+            ++it;
+        }
+        const char *exponent = it;
+        while (it != end && isDecimalDigit(*it)) {
+            ++it;
+        }
+        if (it == exponent) {
+            return false;
+        }
+    }
+    if (it != end) {
+        return false;
+    }
+
+    char *parsed;
+    parseFloatingPoint(number, &parsed, result);
+
+    if (parsed != end) {
+
+        // The C locale decimal point is not '.', fall back to a classic locale stream
+        std::istringstream stream(str);
+        stream.imbue(std::locale::classic());
+        stream >> result;
+        return stream.eof() && !stream.fail() && !stream.bad();
+    }
+    // Overflows are rejected, as by the stream extraction
+    return std::fabs(result) <= std::numeric_limits<T>::max();
+}
+
+template <typename T>
+static inline bool convertTo(const std::string &str, T &result)
+{
+    /* Check that conversion to that type is allowed.
+     * If this fails, this means that this template was not intended to be used
+     * with this type, thus that the result is undefined. */
+    static_assert(ConvertionAllowed<T>::value, "convertTo does not support this conversion");
+
+    const char *it = str.data();
+    const char *end = it + str.size();
+
+    /* Reject white spaces. Also check for a '-' in string: if type is unsigned and a - is
+     * found, the parsing fails. This is made necessary because "-1" would be read as 65535 for
+     * uint16_t, for example */
+    for (const char *c = it; c != end; ++c) {
+        if (isRejectedSpace(*c) || (*c == '-' && !std::numeric_limits<T>::is_signed)) {
             return false;
         }
-    } else {
-        ss >> result;
     }
 
-    return ss.eof() && !ss.fail() && !ss.bad();
+    /* Hexadecimal format is only supported for integers */
+    bool hexadecimal = str.compare(0, 2, "0x") == 0;
+    if (hexadecimal && !std::numeric_limits<T>::is_integer) {
+        return false;
+    }
+
+    /* The number is parsed here rather than through a string stream, which is locale dependent
+     * and costly to build. The stream extraction skipped leading white spaces, of which only
+     * form feeds are left. */
+    while (it != end && *it == '\f') {
+        ++it;
+    }
+    return parseNumber(str, it, end, hexadecimal, result,
+                       std::integral_constant<bool, std::numeric_limits<T>::is_integer>());
 }
 
 template <typename T, typename Via>
@@ -321,3 +470,107 @@ inline bool convertTo<bool>(const std::string &str, bool &result)
 
     return false;
 }
+
+namespace details
+{
+
+/* Format a floating point value with snprintf, as std::ostream does, or with a classic locale
+ * stream if the C locale formatted it with another decimal point than '.' */
+static inline std::string formatFloatingPoint(double value, int precision, bool fixed)
+{
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), fixed ? "%.*f" : "%.*g", precision, value);
+
+    if (length < 0) {
+        return "";
+    }
+    std::string formatted;
+    if (static_cast<size_t>(length) < sizeof(buffer)) {
+        formatted.assign(buffer, static_cast<size_t>(length));
+    } else {
+        formatted.resize(static_cast<size_t>(length));
+        std::snprintf(&formatted[0], formatted.size() + 1, fixed ? "%.*f" : "%.*g", precision,
+                      value);
+    }
+
+    for (char c : formatted) {
+        if (!isDecimalDigit(c) && c != '.' && c != '-' && c != '+' && c != 'e' && c != 'i' &&
+            c != 'n' && c != 'f' && c != 'a') {
+
+            std::ostringstream stream;
+            stream.imbue(std::locale::classic());
+            if (fixed) {
+                stream << std::fixed;
+            }
+            stream << std::setprecision(precision) << value;
+            return stream.str();
+        }
+    }
+    return formatted;
+}
+
+} // namespace details
+
+/**
+ * Format an unsigned integer as "0x" followed by its upper case hexadecimal digits.
+ *
+ * Equivalent to streaming "0x" then the value with std::hex, std::uppercase, std::setw(digits)
+ * and std::setfill('0'), without building a stream. Decimal integers are formatted with
+ * std::to_string, which does not build a stream either.
+ *
+ * @param[in] value  the value to format.
+ * @param[in] digits the minimal number of digits, the value is zero padded up to it.
+ *
+ * @return the formatted value.
+ */
+template <typename T>
+static inline std::string toHexString(T value, size_t digits = 0)
+{
+    static_assert(std::is_unsigned<T>::value, "toHexString only formats unsigned integers");
+
+    char buffer[2 * sizeof(T)];
+    char *begin = buffer + sizeof(buffer);
+
+    do {
+        *--begin = "0123456789ABCDEF"[value & 0xF];
+        value = static_cast<T>(value >> 4);
+    } while (value != 0);
+
+    size_t length = static_cast<size_t>(buffer + sizeof(buffer) - begin);
+    std::string formatted("0x");
+    if (digits > length) {
+        formatted.append(digits - length, '0');
+    }
+    formatted.append(begin, length);
+    return formatted;
+}
+
+/**
+ * Format a floating point value with 6 significant digits, as a default std::ostream does.
+ *
+ * The result does not depend on the locale.
+ *
+ * @param[in] value the value to format.
+ *
+ * @return the formatted value.
+ */
+static inline std::string toGeneralString(double value)
+{
+    return details::formatFloatingPoint(value, 6, false);
+}
+
+/**
+ * Format a floating point value with a fixed number of decimals, as a std::ostream does with
+ * std::fixed and std::setprecision(decimals).
+ *
+ * The result does not depend on the locale.
+ *
+ * @param[in] value    the value to format.
+ * @param[in] decimals the number of decimals.
+ *
+ * @return the formatted value.
+ */
+static inline std::string toFixedString(double value, int decimals)
+{
+    return details::formatFloatingPoint(value, decimals, true);
+}
@@ -30,10 +30,20 @@
 
 #include "Utility.h"
 #include "BinaryCopy.hpp"
+#include "Compression.h"
+#include "BytesDiff.h"
+#include "ParallelFor.hpp"
+#include "InternedString.h"
+#include "Arena.h"
+#include "convert.hpp"
 
 #include <catch.hpp>
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <iomanip>
 #include <map>
+#include <sstream>
 
 using std::list;
 using std::string;
@@ -220,4 +230,505 @@ SCENARIO("binaryCopy bit exactness")
     }
 }
 
+SCENARIO("compression round trip")
+{
+    std::vector<uint8_t> repetitive(1000, 0);
+    for (size_t i = 0; i < repetitive.size(); i += 10) {
+        repetitive[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> noise(1000);
+    uint32_t seed = 42;
+    for (auto &byte : noise) {
+        seed = seed * 1103515245 + 12345;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+    const std::map<string, std::vector<uint8_t>> tests = {
+        {"empty", {}},
+        {"shorter than a match", {1, 2, 3}},
+        {"a single repeated byte", {7, 7, 7, 7, 7, 7}},
+        {"repetitive bytes", repetitive},
+        {"noise", noise}};
+    for (auto &test : tests) {
+        GIVEN ("A sequence of " + test.first) {
+            auto &input = test.second;
+            auto compressed = compression::compress(input);
+
+            THEN ("Decompressing it gives the original sequence back") {
+                std::vector<uint8_t> output;
+                CHECK(compression::decompress(compressed, input.size(), output));
+                CHECK(output == input);
+            }
+            THEN ("Decompressing it with a wrong size fails") {
+                std::vector<uint8_t> output;
+                CHECK_FALSE(compression::decompress(compressed, input.size() + 1, output));
+            }
+            if (not input.empty()) {
+                THEN ("Decompressing a truncated sequence fails") {
+                    compressed.pop_back();
+                    std::vector<uint8_t> output;
+                    CHECK_FALSE(compression::decompress(compressed, input.size(), output));
+                }
+            }
+        }
+    }
+    GIVEN ("A repetitive sequence") {
+        THEN ("It is compressed") {
+            CHECK(compression::compress(repetitive).size() < repetitive.size() / 2);
+        }
+    }
+}
+
+/** Byte by byte reference implementation of diffBytes */
+static std::vector<BytesSpan> referenceDiffBytes(const std::vector<uint8_t> &first,
+                                                 const std::vector<uint8_t> &second)
+{
+    std::vector<BytesSpan> spans;
+    for (size_t index = 0; index < first.size(); ++index) {
+        if (first[index] == second[index]) {
+            continue;
+        }
+        if (not spans.empty() && spans.back().offset + spans.back().size == index) {
+            ++spans.back().size;
+        } else {
+            spans.push_back({index, 1});
+        }
+    }
+    return spans;
+}
+
+SCENARIO("diffBytes")
+{
+    // Sizes around the vector and word widths, and differences around their boundaries
+    for (size_t size : {0, 1, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1000}) {
+        std::vector<uint8_t> first(size);
+        uint32_t seed = static_cast<uint32_t>(size);
+        for (auto &byte : first) {
+            seed = seed * 1103515245 + 12345;
+            byte = static_cast<uint8_t>(seed >> 16);
+        }
+        GIVEN ("Two ranges of " + std::to_string(size) + " bytes") {
+            std::vector<uint8_t> second = first;
+
+            THEN ("Identical ranges have no differing span") {
+                CHECK(diffBytes(first.data(), second.data(), size).empty());
+            }
+            THEN ("Scattered and contiguous differences are spanned") {
+                for (size_t index = 0; index < size; index += 1 + index % 13) {
+                    second[index] ^= 0x5a;
+                }
+                for (size_t index = size / 2; index < size && index < size / 2 + 40; ++index) {
+                    second[index] = static_cast<uint8_t>(~first[index]);
+                }
+                CHECK(diffBytes(first.data(), second.data(), size) ==
+                      referenceDiffBytes(first, second));
+            }
+            THEN ("Fully different ranges are a single span") {
+                for (auto &byte : second) {
+                    byte = static_cast<uint8_t>(~byte);
+                }
+                CHECK(diffBytes(first.data(), second.data(), size) ==
+                      referenceDiffBytes(first, second));
+            }
+            THEN ("Unaligned ranges are compared") {
+                if (size > 3) {
+                    second[size - 2] ^= 1;
+                    CHECK(diffBytes(first.data() + 3, second.data() + 3, size - 3) ==
+                          std::vector<BytesSpan>{{size - 5, 1}});
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("parallelFor")
+{
+    for (size_t concurrency : {1, 2, 8}) {
+        GIVEN ("A concurrency of " + std::to_string(concurrency)) {
+            THEN ("Each index is handed out exactly once") {
+                std::vector<std::atomic<int>> calls(100);
+                for (auto &call : calls) {
+                    call = 0;
+                }
+                parallelFor(calls.size(), concurrency, [&](size_t index) { calls[index]++; });
+                for (auto &call : calls) {
+                    CHECK(call == 1);
+                }
+            }
+            THEN ("No index means no call") {
+                bool called = false;
+                parallelFor(0, concurrency, [&](size_t) { called = true; });
+                CHECK(not called);
+            }
+        }
+    }
+}
+
+SCENARIO("InternedString")
+{
+    GIVEN ("Two strings interned from distinct copies of the same value") {
+        InternedString first(std::string("kind"));
+        InternedString second(std::string("kind"));
+        THEN ("They share their storage") {
+            CHECK(first == second);
+            CHECK(&first.str() == &second.str());
+            CHECK(first.str() == "kind");
+        }
+        THEN ("They differ from another value") {
+            CHECK(first != InternedString("name"));
+        }
+        THEN ("The value can be found without interning") {
+            InternedString found;
+            REQUIRE(InternedString::find("kind", found));
+            CHECK(found == first);
+        }
+    }
+    GIVEN ("A string never interned") {
+        THEN ("It is not found") {
+            InternedString found;
+            CHECK(not InternedString::find("never interned string", found));
+            CHECK(found.empty());
+        }
+    }
+    GIVEN ("The empty string") {
+        THEN ("It is the default interned string") {
+            CHECK(InternedString(std::string()) == InternedString());
+            CHECK(InternedString().str().empty());
+        }
+    }
+    GIVEN ("Enough strings interned concurrently to grow the table several times") {
+        const size_t count = 20000;
+        std::atomic<size_t> lost{0};
+
+        parallelFor(4, 4, [&](size_t worker) {
+            for (size_t i = worker; i < count; i += 4) {
+                std::string value = "concurrent " + std::to_string(i);
+                InternedString interned(value);
+                InternedString found;
+
+                // Lookups do not lock: they must see the strings interned by any thread
+                if (not InternedString::find(value, found) || found != interned ||
+                    (i >= 4 && not InternedString::find("concurrent " + std::to_string(i - 4),
+                                                        found))) {
+                    lost++;
+                }
+            }
+        });
+        THEN ("Each of them is found") {
+            CHECK(lost == 0);
+            size_t missing = 0;
+            for (size_t i = 0; i < count; i++) {
+                InternedString found;
+                std::string value = "concurrent " + std::to_string(i);
+                if (not InternedString::find(value, found) || found != InternedString(value)) {
+                    missing++;
+                }
+            }
+            CHECK(missing == 0);
+        }
+    }
+}
+
+SCENARIO("Arena")
+{
+    GIVEN ("An arena of 64 bytes blocks") {
+        Arena arena(64);
+        THEN ("Allocations in sequence are contiguous and aligned") {
+            auto first = static_cast<char *>(arena.allocate(8, 8));
+            auto second = static_cast<char *>(arena.allocate(8, 8));
+            CHECK(reinterpret_cast<uintptr_t>(first) % 8 == 0);
+            CHECK(second == first + 8);
+            auto third = static_cast<char *>(arena.allocate(1, 1));
+            auto fourth = static_cast<char *>(arena.allocate(4, 4));
+            CHECK(third == second + 8);
+            CHECK(fourth == third + 4);
+        }
+        THEN ("A full block is followed by a new one") {
+            arena.allocate(48);
+            arena.allocate(48);
+            CHECK(arena.getCapacity() == 128);
+        }
+        THEN ("An oversized allocation gets a block of its own") {
+            arena.allocate(1000);
+            CHECK(arena.getCapacity() >= 1000);
+        }
+        THEN ("Clearing frees all blocks") {
+            arena.allocate(8);
+            arena.clear();
+            CHECK(arena.getCapacity() == 0);
+        }
+    }
+}
+
+/** Measure diffBytes and a byte by byte comparison on 64 B to 1 MiB ranges.
+ * Hidden from default runs, select it with the "[benchmark]" tag.
+ */
+TEST_CASE("diffBytes benchmark", "[.][benchmark]")
+{
+    using clock = std::chrono::steady_clock;
+    const size_t budget = 64 * 1024 * 1024;
+
+    for (size_t size = 64; size <= 1024 * 1024; size *= 4) {
+        std::vector<uint8_t> first(size, 0);
+        std::vector<uint8_t> second(size, 0);
+        // One differing byte per KiB (at least one): the usual configuration diff shape
+        for (size_t index = size / 2 % 1024; index < size; index += 1024) {
+            second[index] = 1;
+        }
+        const size_t iterations = budget / size;
+
+        size_t spanCount = 0;
+        auto start = clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            spanCount += diffBytes(first.data(), second.data(), size).size();
+        }
+        auto vectorized = clock::now() - start;
+
+        size_t referenceCount = 0;
+        start = clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            referenceCount += referenceDiffBytes(first, second).size();
+        }
+        auto reference = clock::now() - start;
+
+        CHECK(spanCount == referenceCount);
+        auto perCall = [&](clock::duration duration) {
+            return std::to_string(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() /
+                static_cast<long long>(iterations));
+        };
+        WARN(std::to_string(size) + " B: diffBytes " + perCall(vectorized) +
+             " ns, byte by byte " + perCall(reference) + " ns");
+    }
+}
+
+/** String stream based reference implementation of convertTo, as it was before parsing by hand */
+template <typename T>
+static bool referenceConvertTo(const string &str, T &result)
+{
+    if (str.find_first_of(string("\r\n\t\v ")) != string::npos) {
+        return false;
+    }
+    if (str.find("-") != string::npos && !std::numeric_limits<T>::is_signed) {
+        return false;
+    }
+    std::stringstream ss(str);
+    if (str.substr(0, 2) == "0x") {
+        if (std::numeric_limits<T>::is_integer) {
+            ss >> std::hex >> result;
+        } else {
+            return false;
+        }
+    } else {
+        ss >> result;
+    }
+    return ss.eof() && !ss.fail() && !ss.bad() &&
+           (std::numeric_limits<T>::is_integer || std::isfinite(static_cast<double>(result)));
+}
+
+/** Characters steering all the parsing branches */
+static const string convertAlphabet = "019afAFxX+-.eE \f";
+
+/** All strings of up to maxLength characters of alphabet, prefixed with prefix */
+static std::vector<string> allStrings(const string &alphabet, size_t maxLength,
+                                      const string &prefix = "")
+{
+    std::vector<string> strings{prefix};
+    for (size_t begin = 0, length = 0; length < maxLength; ++length) {
+        size_t end = strings.size();
+        for (size_t index = begin; index < end; ++index) {
+            for (char c : alphabet) {
+                strings.push_back(strings[index] + c);
+            }
+        }
+        begin = end;
+    }
+    return strings;
+}
+
+/** Strings around the limits of T, and of the types it is read through */
+template <typename T>
+static std::vector<string> limitStrings()
+{
+    std::vector<string> strings;
+    for (long double limit : {-1e40L, -1e39L, -3.5e38L, -1.8e19L, -9.3e18L, -2.2e9L, -3.3e4L,
+                              -129.L, -1.L, 0.L, 1.L, 128.L, 256.L, 3.3e4L, 6.6e4L, 2.2e9L,
+                              4.3e9L, 9.3e18L, 1.8e19L, 3.5e38L}) {
+        std::ostringstream stream;
+        stream << std::setprecision(20) << limit;
+        strings.push_back(stream.str());
+    }
+    for (long long value : {(long long)std::numeric_limits<T>::min(),
+                            (long long)std::numeric_limits<T>::max()}) {
+        for (long long delta : {-1, 0, 1}) {
+            strings.push_back(std::to_string(value + delta));
+        }
+    }
+    auto max = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+    for (unsigned long long value : {max - 1, max, max + 1, 2 * max + 1, 2 * max + 2}) {
+        strings.push_back(std::to_string(value));
+        std::ostringstream stream;
+        stream << "0x" << std::hex << value;
+        strings.push_back(stream.str());
+    }
+    for (const char *string :
+         {"18446744073709551615", "18446744073709551616", "99999999999999999999",
+          "0xFFFFFFFFFFFFFFFF", "0x10000000000000000", "0x0x0x1", "0x0X1", "0x00x1", "\f\f12",
+          "12\f", "1e308", "1e309", "-1e309", "1e-400", "3.4e38", "3.5e38", "1.17e-38", "1e-46",
+          "1.5", "-0.0", "+.5", "5.", "0.1e+3", "1e+", "inf", "nan", "0x1p3", "1,5", "1_0",
+          "", "\f", "1\0"}) {
+        strings.push_back(string);
+    }
+    strings.push_back(string("1\0", 2));
+    return strings;
+}
+
+template <typename T>
+static void checkConvertToEquivalence(const std::vector<string> &strings)
+{
+    for (const auto &str : strings) {
+        T result{};
+        T reference{};
+        bool converted = convertTo(str, result);
+        bool referenceConverted = referenceConvertTo(str, reference);
+        if (std::is_same<T, unsigned char>::value || std::is_same<T, signed char>::value) {
+            // Converted through int or unsigned int, then checked against the type range
+            typename std::conditional<std::is_signed<T>::value, int, unsigned int>::type wide;
+            referenceConverted = referenceConvertTo(str, wide) &&
+                                 wide >= std::numeric_limits<T>::min() &&
+                                 wide <= std::numeric_limits<T>::max();
+            reference = static_cast<T>(wide);
+        }
+        INFO("Type size " << sizeof(T) << ", input \"" << str << "\"");
+        REQUIRE(converted == referenceConverted);
+        if (converted) {
+            REQUIRE(result == reference);
+            REQUIRE(std::signbit(static_cast<double>(result)) ==
+                    std::signbit(static_cast<double>(reference)));
+        }
+    }
+}
+
+template <typename T>
+static void checkConvertToEquivalence()
+{
+    checkConvertToEquivalence<T>(allStrings(convertAlphabet, 4));
+    checkConvertToEquivalence<T>(allStrings(convertAlphabet, 3, "0x"));
+    checkConvertToEquivalence<T>(limitStrings<T>());
+}
+
+SCENARIO("convertTo equivalence with string streams")
+{
+    checkConvertToEquivalence<long long>();
+    checkConvertToEquivalence<unsigned long long>();
+    checkConvertToEquivalence<long>();
+    checkConvertToEquivalence<unsigned long>();
+    checkConvertToEquivalence<int>();
+    checkConvertToEquivalence<unsigned int>();
+    checkConvertToEquivalence<short>();
+    checkConvertToEquivalence<unsigned short>();
+    checkConvertToEquivalence<unsigned char>();
+    checkConvertToEquivalence<signed char>();
+    checkConvertToEquivalence<float>();
+    checkConvertToEquivalence<double>();
+}
+
+SCENARIO("Number formatting equivalence with string streams")
+{
+    GIVEN ("Hexadecimal formatting") {
+        for (uint64_t value : {0ull, 1ull, 0xAull, 0x1234ull, 0xFFFFFFFFull, ~0ull}) {
+            for (size_t digits : {0, 1, 2, 8, 16, 20}) {
+                std::ostringstream stream;
+                stream << "0x" << std::hex << std::uppercase << std::setw(static_cast<int>(digits))
+                       << std::setfill('0') << value;
+                CHECK(toHexString(value, digits) == stream.str());
+            }
+        }
+        CHECK(toHexString<uint8_t>(0xF, 2) == "0x0F");
+    }
+    GIVEN ("Floating point formatting") {
+        for (double value : {0., -0., 1., -1.5, 0.1, 1. / 3, 123456., 1234567., 1e-5, 1e-4,
+                             -2.5e-300, 1e300, double(std::numeric_limits<float>::max()),
+                             std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::infinity()}) {
+            std::ostringstream general;
+            general << value;
+            CHECK(toGeneralString(value) == general.str());
+
+            for (int decimals : {0, 1, 2, 6, 15, 31}) {
+                std::ostringstream fixed;
+                fixed << std::fixed << std::setprecision(decimals) << value;
+                CHECK(toFixedString(value, decimals) == fixed.str());
+            }
+        }
+    }
+}
+
+/** Measure convertTo and the string stream based parsing, then the formatting functions and
+ * their string stream equivalents, on typical settings values.
+ * Hidden from default runs, select it with the "[benchmark]" tag.
+ */
+TEST_CASE("convertTo benchmark", "[.][benchmark]")
+{
+    using clock = std::chrono::steady_clock;
+    const size_t iterations = 200000;
+    const std::vector<string> integers{"0", "42", "65535", "-1234", "0x7FFF", "4000000000"};
+    const std::vector<string> reals{"0", "1.5", "-0.001", "3.14159", "1e-3", "-12345.678"};
+
+    auto perCall = [&](clock::duration duration, size_t count) {
+        return std::to_string(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() /
+            static_cast<long long>(iterations * count));
+    };
+    auto measure = [&](const std::vector<string> &strings, std::function<bool(const string &)> f) {
+        size_t converted = 0;
+        auto start = clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            for (const auto &str : strings) {
+                converted += f(str);
+            }
+        }
+        return std::make_pair(clock::now() - start, converted);
+    };
+
+    long long integer;
+    auto parsed = measure(integers, [&](const string &str) { return convertTo(str, integer); });
+    auto reference =
+        measure(integers, [&](const string &str) { return referenceConvertTo(str, integer); });
+    CHECK(parsed.second == reference.second);
+    WARN("Integer parsing: convertTo " + perCall(parsed.first, integers.size()) +
+         " ns, string stream " + perCall(reference.first, integers.size()) + " ns");
+
+    double real;
+    parsed = measure(reals, [&](const string &str) { return convertTo(str, real); });
+    reference = measure(reals, [&](const string &str) { return referenceConvertTo(str, real); });
+    CHECK(parsed.second == reference.second);
+    WARN("Floating point parsing: convertTo " + perCall(parsed.first, reals.size()) +
+         " ns, string stream " + perCall(reference.first, reals.size()) + " ns");
+
+    size_t length = 0;
+    auto start = clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        length += toHexString(static_cast<uint32_t>(i), 4).size();
+        length += toFixedString(static_cast<double>(i) / 1024, 10).size();
+    }
+    auto formatted = clock::now() - start;
+
+    size_t referenceLength = 0;
+    start = clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        std::ostringstream hex;
+        hex << "0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0')
+            << static_cast<uint32_t>(i);
+        referenceLength += hex.str().size();
+        std::ostringstream fixed;
+        fixed << std::fixed << std::setprecision(10) << static_cast<double>(i) / 1024;
+        referenceLength += fixed.str().size();
+    }
+    auto streamed = clock::now() - start;
+
+    CHECK(length == referenceLength);
+    WARN("Hexadecimal and fixed formatting: " + perCall(formatted, 2) + " ns, string stream " +
+         perCall(streamed, 2) + " ns");
+}
+
 } // namespace utility
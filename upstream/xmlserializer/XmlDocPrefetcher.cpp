@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "XmlDocPrefetcher.h"
+#include "XmlDocSource.h"
+#include "XmlElement.h"
+#include "XmlSerializingContext.h"
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <algorithm>
+#include <thread>
+
+using std::string;
+
+CXmlDocPrefetcher::~CXmlDocPrefetcher()
+{
+    for (auto &reader : mReaders) {
+        reader.wait();
+    }
+    for (auto &untaken : mUntakenDocs) {
+        for (; !untaken.second.empty(); untaken.second.pop()) {
+            xmlFreeDoc(mReadyDocs[untaken.second.front()].get());
+        }
+    }
+}
+
+void CXmlDocPrefetcher::prefetchIncludes(_xmlDoc *doc, const string &includeType,
+                                         const string &baseUri, bool bValidateWithSchemas,
+                                         const string &schemaBaseUri)
+{
+    mValidateWithSchemas = bValidateWithSchemas;
+    mSchemaBaseUri = schemaBaseUri;
+    mRootElementType = includeType.substr(0, includeType.rfind("Include"));
+
+    CXmlElement::CChildIterator it(CXmlElement(xmlDocGetRootElement(doc)));
+    CXmlElement child;
+
+    while (it.next(child)) {
+
+        string path;
+        if (child.getType() == includeType && child.getAttribute("Path", path)) {
+
+            string uri = CXmlDocSource::mkUri(baseUri, path);
+
+            mUntakenDocs[uri].push(mUris.size());
+            mUris.push_back(uri);
+        }
+    }
+    if (mUris.empty()) {
+        return;
+    }
+
+    mValidated.resize(mUris.size());
+    mDocs.resize(mUris.size());
+    for (auto &doc : mDocs) {
+        mReadyDocs.push_back(doc.get_future());
+    }
+
+    // libxml2 must be initialized before being used from several threads
+    xmlInitParser();
+
+    size_t nbReaders = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                        mUris.size());
+    for (size_t reader = 0; reader < nbReaders; reader++) {
+        mReaders.push_back(std::async(std::launch::async, &CXmlDocPrefetcher::read, this));
+    }
+}
+
+_xmlDoc *CXmlDocPrefetcher::take(const string &uri, bool &bValidated)
+{
+    bValidated = false;
+    auto untaken = mUntakenDocs.find(uri);
+
+    if (untaken == mUntakenDocs.end() || untaken->second.empty()) {
+        return NULL;
+    }
+    size_t index = untaken->second.front();
+    untaken->second.pop();
+
+    _xmlDoc *doc = mReadyDocs[index].get();
+    bValidated = mValidated[index] != 0;
+
+    return doc;
+}
+
+void CXmlDocPrefetcher::read()
+{
+    for (size_t index = mNextRead++; index < mUris.size(); index = mNextRead++) {
+
+        // Errors are dropped: failing documents are read or validated again when taken, so
+        // that their errors are reported in the processing order
+        string error;
+        CXmlSerializingContext context(error);
+
+        _xmlDoc *doc = CXmlDocSource::mkXmlDoc(mUris[index], true, true, context);
+
+        if (doc != NULL && mValidateWithSchemas) {
+
+            // Compiled schemas are shared, each validation has its own context
+            CXmlDocSource docSource(doc, true, mRootElementType);
+            if (!mSchemaBaseUri.empty()) {
+                docSource.setSchemaBaseUri(mSchemaBaseUri);
+            }
+            mValidated[index] = docSource.populate(context);
+            docSource.releaseDoc();
+        }
+        mDocs[index].set_value(doc);
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <future>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+struct _xmlDoc;
+
+/** Reads the documents included by a document ahead of their use, concurrently
+ *
+ * The included documents are read, with their XIncludes resolved, and validated against their
+ * schema if requested, by a pool of threads while the including document is being processed.
+ * They are then taken in any order by the processing, which waits for them if needed.
+ */
+class CXmlDocPrefetcher
+{
+public:
+    CXmlDocPrefetcher() = default;
+    CXmlDocPrefetcher(const CXmlDocPrefetcher &) = delete;
+    CXmlDocPrefetcher &operator=(const CXmlDocPrefetcher &) = delete;
+
+    /** Wait for the reads in progress and free the documents that were not taken */
+    ~CXmlDocPrefetcher();
+
+    /** Start reading the documents included by the root element children of a document
+     *
+     * Must be called once at most.
+     *
+     * @param[in] doc the including document
+     * @param[in] includeType the type of the elements including a document, the type of the
+     *                        included root elements followed by "Include"
+     * @param[in] baseUri the URI the Path attribute of the including elements is relative to
+     * @param[in] bValidateWithSchemas true if the included documents are to be validated
+     * @param[in] schemaBaseUri the URI of the folder of the schemas, the default one if empty
+     */
+    void prefetchIncludes(_xmlDoc *doc, const std::string &includeType,
+                          const std::string &baseUri, bool bValidateWithSchemas,
+                          const std::string &schemaBaseUri);
+
+    /** Take a prefetched document
+     *
+     * @param[in] uri the URI of the document
+     * @param[out] bValidated true if the document was found valid, false if it was not
+     *                        validated or is invalid, validating it again then reports the error
+     * @return the document, to be freed by the caller, NULL if the document was not prefetched
+     *         or could not be read. In the latter case, reading it again reports the error.
+     */
+    _xmlDoc *take(const std::string &uri, bool &bValidated);
+
+private:
+    void read();
+
+    bool mValidateWithSchemas{false};
+    std::string mSchemaBaseUri;
+    std::string mRootElementType;
+
+    std::vector<std::string> mUris;
+    /** Written before the document is made ready, read once it is taken */
+    std::vector<char> mValidated;
+    std::vector<std::promise<_xmlDoc *>> mDocs;
+    std::vector<std::future<_xmlDoc *>> mReadyDocs;
+    std::map<std::string, std::queue<size_t>> mUntakenDocs;
+
+    std::atomic<size_t> mNextRead{0};
+    std::vector<std::future<void>> mReaders;
+};
@@ -29,6 +29,7 @@
  */
 
 #include "XmlDocSource.h"
+#include "XmlSchemaCache.h"
 #include "AlwaysAssert.hpp"
 #include <libxml/tree.h>
 #include <libxml/xmlschemas.h>
@@ -94,12 +95,12 @@ string CXmlDocSource::getSchemaBaseUri()
     return _schemaBaseUri;
 }
 
-string CXmlDocSource::getSchemaUri() const
+string CXmlDocSource::getSchemaUri(const string &strRootElementName) const
 {
     // Adding a trailing '/' is a bit dirty but works fine on both Linux and
     // Windows in order to make sure that libxml2's URI handling methods
     // interpret the base URI as a folder.
-    return mkUri(_schemaBaseUri + "/", getRootElementName() + ".xsd");
+    return mkUri(_schemaBaseUri + "/", strRootElementName + ".xsd");
 }
 
 _xmlDoc *CXmlDocSource::getDoc() const
@@ -107,6 +108,13 @@ _xmlDoc *CXmlDocSource::getDoc() const
     return _pDoc;
 }
 
+_xmlDoc *CXmlDocSource::releaseDoc()
+{
+    _xmlDoc *doc = _pDoc;
+    _pDoc = NULL;
+    return doc;
+}
+
 bool CXmlDocSource::isParsable() const
 {
     // Check that the doc has been created
@@ -133,6 +141,11 @@ bool CXmlDocSource::populate(CXmlSerializingContext &serializingContext)
         }
     }
 
+    return checkRootElement(serializingContext);
+}
+
+bool CXmlDocSource::checkRootElement(CXmlSerializingContext &serializingContext) const
+{
     // Check Root element type
     if (getRootElementName() != _strRootElementType) {
 
@@ -165,51 +178,25 @@ bool CXmlDocSource::populate(CXmlSerializingContext &serializingContext)
 bool CXmlDocSource::isInstanceDocumentValid()
 {
 #ifdef LIBXML_SCHEMAS_ENABLED
-    string schemaUri = getSchemaUri();
-
-    xmlDocPtr pSchemaDoc = xmlReadFile(schemaUri.c_str(), NULL, XML_PARSE_NONET);
+    // Compiled once per process
+    CXmlSchemaCache::Schema schema =
+        CXmlSchemaCache::getInstance().getSchema(getSchemaUri(getRootElementName()));
 
-    if (!pSchemaDoc) {
-        // Unable to load Schema
+    if (!schema) {
+        // Unable to load or compile Schema
         return false;
     }
-
-    xmlSchemaParserCtxtPtr pParserCtxt = xmlSchemaNewDocParserCtxt(pSchemaDoc);
-
-    if (!pParserCtxt) {
-
-        // Unable to create schema context
-        xmlFreeDoc(pSchemaDoc);
-        return false;
-    }
-
-    // Get Schema
-    xmlSchemaPtr pSchema = xmlSchemaParse(pParserCtxt);
-
-    if (!pSchema) {
-
-        // Invalid Schema
-        xmlSchemaFreeParserCtxt(pParserCtxt);
-        xmlFreeDoc(pSchemaDoc);
-        return false;
-    }
-    xmlSchemaValidCtxtPtr pValidationCtxt = xmlSchemaNewValidCtxt(pSchema);
+    xmlSchemaValidCtxtPtr pValidationCtxt = xmlSchemaNewValidCtxt(schema.get());
 
     if (!pValidationCtxt) {
 
         // Unable to create validation context
-        xmlSchemaFree(pSchema);
-        xmlSchemaFreeParserCtxt(pParserCtxt);
-        xmlFreeDoc(pSchemaDoc);
         return false;
     }
 
     bool isDocValid = xmlSchemaValidateDoc(pValidationCtxt, _pDoc) == 0;
 
     xmlSchemaFreeValidCtxt(pValidationCtxt);
-    xmlSchemaFree(pSchema);
-    xmlSchemaFreeParserCtxt(pParserCtxt);
-    xmlFreeDoc(pSchemaDoc);
 
     return isDocValid;
 #else
@@ -259,3 +246,44 @@ _xmlDoc *CXmlDocSource::mkXmlDoc(const string &source, bool fromFile, bool xincl
 
     return doc;
 }
+
+namespace
+{
+
+void listXIncludedUris(xmlNode *node, std::vector<string> &uris)
+{
+    for (; node != NULL; node = node->next) {
+
+        if (node->type == XML_ELEMENT_NODE) {
+
+            listXIncludedUris(node->children, uris);
+            continue;
+        }
+        if (node->type != XML_XINCLUDE_START) {
+
+            continue;
+        }
+        // XInclude start nodes are not elements, their attributes can not be got by name
+        xmlAttr *attribute = node->properties;
+        while (attribute != NULL && !xmlStrEqual(attribute->name, BAD_CAST "href")) {
+            attribute = attribute->next;
+        }
+        if (attribute == NULL) {
+            continue;
+        }
+        xml_unique_ptr href(xmlNodeListGetString(node->doc, attribute->children, 1), xmlFree);
+        xml_unique_ptr base(xmlNodeGetBase(node->doc, node), xmlFree);
+        xml_unique_ptr uri(xmlBuildURI(href.get(), base.get()), xmlFree);
+
+        if (uri) {
+            uris.push_back(reinterpret_cast<const char *>(uri.get()));
+        }
+    }
+}
+
+} // namespace
+
+void CXmlDocSource::listXIncludedUris(_xmlDoc *doc, std::vector<string> &uris)
+{
+    ::listXIncludedUris(xmlDocGetRootElement(doc), uris);
+}
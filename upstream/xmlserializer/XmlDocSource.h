@@ -35,6 +35,7 @@
 #include "NonCopyable.hpp"
 
 #include <string>
+#include <vector>
 
 struct _xmlDoc;
 struct _xmlNode;
@@ -133,6 +134,13 @@ public:
       */
     _xmlDoc *getDoc() const;
 
+    /**
+      * Give up the ownership of the document, which is no longer freed with the source
+      *
+      * @return the document _pDoc, to be freed by the caller
+      */
+    _xmlDoc *releaseDoc();
+
     /**
     * Method that checks that the xml document has been correctly parsed.
     *
@@ -170,7 +178,37 @@ public:
     static _xmlDoc *mkXmlDoc(const std::string &source, bool fromFile, bool xincludes,
                              CXmlSerializingContext &serializingContext);
 
+    /**
+     * List the files XIncluded in a document
+     *
+     * @param[in] doc the document, whose XIncludes have been processed
+     * @param[out] uris the list the URIs of the XIncluded files are appended to
+     */
+    static void listXIncludedUris(_xmlDoc *doc, std::vector<std::string> &uris);
+
 protected:
+    /**
+      * Check the root element type and name attribute against the expected ones.
+      *
+      * @param[out] serializingContext is used as error output
+      *
+      * @return false if the root element mismatches
+      */
+    bool checkRootElement(CXmlSerializingContext &serializingContext) const;
+
+    /** @return true if the document has to be validated with its schema */
+    bool isSchemaValidationRequired() const { return _bValidateWithSchema; }
+
+    /** @return the expected root element type */
+    const std::string &getRootElementType() const { return _strRootElementType; }
+
+    /**
+      * @param[in] strRootElementName the name of the document root element
+      *
+      * @return the URI of the schema validating a document of that root element
+      */
+    std::string getSchemaUri(const std::string &strRootElementName) const;
+
     /**
       * Doc
       */
@@ -187,7 +225,6 @@ private:
       * @return true if document is valid, false if any error occures
       */
     bool isInstanceDocumentValid();
-    std::string getSchemaUri() const;
 
     /**
       * Element type info
@@ -135,6 +135,59 @@ string CXmlElement::getTextContent() const
     return strContent;
 }
 
+namespace
+{
+
+/** Feed a string and its terminating null character to a FNV-1a 64 bit hash */
+void hashString(const xmlChar *value, uint64_t &hash)
+{
+    do {
+        hash = (hash ^ *value) * 0x100000001b3ULL;
+    } while (*value++ != '\0');
+}
+
+void hashNode(const xmlNode *node, uint64_t &hash)
+{
+    if (node->type == XML_TEXT_NODE || node->type == XML_CDATA_SECTION_NODE) {
+
+        hashString(node->content, hash);
+        return;
+    }
+    if (node->type != XML_ELEMENT_NODE) {
+
+        // Comments and processing instructions do not describe anything
+        return;
+    }
+    hashString(node->name, hash);
+
+    for (const xmlAttr *attribute = node->properties; attribute != NULL;
+         attribute = attribute->next) {
+
+        hashString(attribute->name, hash);
+
+        for (const xmlNode *value = attribute->children; value != NULL; value = value->next) {
+
+            hashNode(value, hash);
+        }
+    }
+    for (const xmlNode *child = node->children; child != NULL; child = child->next) {
+
+        hashNode(child, hash);
+    }
+    // Closes the element, so that siblings are not taken for children
+    hashString(BAD_CAST "", hash);
+}
+
+} // namespace
+
+uint64_t CXmlElement::hash() const
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hashNode(_pXmlElement, hash);
+
+    return hash;
+}
+
 bool CXmlElement::getChildElement(const string &strType, CXmlElement &childElement) const
 {
     CChildIterator childIterator(*this);
@@ -71,6 +71,12 @@ public:
 
     std::string getTextContent() const;
 
+    /** Hash the element and its descendants as parsed: their names, attributes and texts
+     *
+     * @return a 64 bit FNV-1a hash, equal for elements of identical content
+     */
+    uint64_t hash() const;
+
     // Navigation
     bool getChildElement(const std::string &strType, CXmlElement &childElement) const;
     bool getChildElement(const std::string &strType, const std::string &strNameAttribute,
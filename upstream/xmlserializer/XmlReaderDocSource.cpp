@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "XmlReaderDocSource.h"
+#include "XmlSchemaCache.h"
+#include <libxml/xmlreader.h>
+#include <libxml/xinclude.h>
+#include <libxml/xmlschemas.h>
+
+using std::string;
+
+CXmlReaderDocSource::CXmlReaderDocSource(const string &uri, bool bXIncludes,
+                                         bool bValidateWithSchema,
+                                         const string &strRootElementType,
+                                         const string &strRootElementName,
+                                         const string &strNameAttributeName)
+    : CXmlDocSource(NULL, bValidateWithSchema, strRootElementType, strRootElementName,
+                    strNameAttributeName),
+      _uri(uri), _bXIncludes(bXIncludes)
+{
+}
+
+CXmlReaderDocSource::~CXmlReaderDocSource()
+{
+    // The reader owns the document and the nodes read so far
+    _pRootNode = NULL;
+    xmlFreeTextReader(_pReader);
+}
+
+bool CXmlReaderDocSource::isParsable() const
+{
+    return _pRootNode != NULL;
+}
+
+bool CXmlReaderDocSource::populate(CXmlSerializingContext &serializingContext)
+{
+    _pReader = xmlReaderForFile(_uri.c_str(), NULL, _bXIncludes ? XML_PARSE_XINCLUDE : 0);
+
+    if (_pReader == NULL) {
+
+        setReadError(serializingContext);
+        return false;
+    }
+
+    // Go to the root element
+    int ret;
+    while ((ret = xmlTextReaderRead(_pReader)) == 1 &&
+           xmlTextReaderNodeType(_pReader) != XML_READER_TYPE_ELEMENT) {
+    }
+    if (ret != 1) {
+
+        setReadError(serializingContext);
+        return false;
+    }
+    _pRootNode = xmlTextReaderCurrentNode(_pReader);
+
+    return checkRootElement(serializingContext);
+}
+
+bool CXmlReaderDocSource::processChildren(const std::function<bool(const CXmlElement &)> &process,
+                                          CXmlSerializingContext &serializingContext)
+{
+    int ret = xmlTextReaderRead(_pReader);
+
+    while (ret == 1 && xmlTextReaderDepth(_pReader) > 0) {
+
+        if (xmlTextReaderDepth(_pReader) != 1 ||
+            xmlTextReaderNodeType(_pReader) != XML_READER_TYPE_ELEMENT) {
+
+            ret = xmlTextReaderRead(_pReader);
+            continue;
+        }
+
+        // Read the whole child
+        xmlNodePtr child = xmlTextReaderExpand(_pReader);
+
+        if (child == NULL) {
+
+            setReadError(serializingContext);
+            return false;
+        }
+        if (_bXIncludes && xmlXIncludeProcessTree(child) < 0) {
+
+            serializingContext.appendLineToError("libxml failed to resolve XIncludes");
+            return false;
+        }
+
+        if (!isChildValid(child, serializingContext) || !process(CXmlElement(child))) {
+
+            return false;
+        }
+
+        // Skip to the next sibling, the reader frees the child
+        ret = xmlTextReaderNext(_pReader);
+    }
+
+    if (ret < 0) {
+
+        setReadError(serializingContext);
+        return false;
+    }
+
+    // Validate the end of the document
+    while (ret == 1) {
+
+        ret = xmlTextReaderRead(_pReader);
+    }
+
+    if (ret < 0) {
+
+        setReadError(serializingContext);
+        return false;
+    }
+
+    return true;
+}
+
+bool CXmlReaderDocSource::isChildValid(_xmlNode *child, CXmlSerializingContext &serializingContext)
+{
+#ifdef LIBXML_SCHEMAS_ENABLED
+    if (!isSchemaValidationRequired()) {
+
+        return true;
+    }
+    // Once its XIncludes are resolved, the child is validated against its own schema
+    CXmlSchemaCache::Schema schema = CXmlSchemaCache::getInstance().getSchema(
+        getSchemaUri(reinterpret_cast<const char *>(child->name)));
+    xmlSchemaValidCtxtPtr pValidationCtxt =
+        schema ? xmlSchemaNewValidCtxt(schema.get()) : nullptr;
+
+    bool isValid =
+        pValidationCtxt != nullptr && xmlSchemaValidateOneElement(pValidationCtxt, child) == 0;
+
+    xmlSchemaFreeValidCtxt(pValidationCtxt);
+
+    // The root element schema requires unique child names
+    xmlChar *name = xmlGetProp(child, reinterpret_cast<const xmlChar *>("Name"));
+
+    if (name != nullptr) {
+
+        isValid = _childNames.insert(reinterpret_cast<const char *>(name)).second && isValid;
+        xmlFree(name);
+    }
+
+    if (!isValid) {
+
+        serializingContext.setError("Document is not valid");
+        return false;
+    }
+#endif
+    return true;
+}
+
+void CXmlReaderDocSource::setReadError(CXmlSerializingContext &serializingContext) const
+{
+    serializingContext.appendLineToError("libxml failed to read \"" + _uri + "\"");
+}
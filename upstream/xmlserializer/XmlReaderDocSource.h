@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "XmlDocSource.h"
+
+#include <functional>
+#include <set>
+#include <string>
+
+struct _xmlTextReader;
+
+/** Document source reading its root element children one at a time
+ *
+ * Unlike the document sources reading the whole document in memory, only the root element and
+ * the child being processed are in memory: the peak memory does not depend on the number of
+ * children. The children are read, validated and freed in document order.
+ *
+ * With schema validation, each child is validated once its XIncludes are resolved, against the
+ * schema named after its element (ConfigurableDomain.xsd for a ConfigurableDomain). Of the
+ * constraints the root element schema sets across its children, only the uniqueness of their
+ * names is checked.
+ */
+class CXmlReaderDocSource : public CXmlDocSource
+{
+public:
+    /**
+      * Constructor
+      *
+      * @param[in] uri the URI of the document to read
+      * @param[in] bXIncludes if true, process xincludes tags
+      * @param[in] bValidateWithSchema a boolean that toggles schema validation
+      * @param[in] strRootElementType a string containing the root element type
+      * @param[in] strRootElementName a string containing the root element name
+      * @param[in] strNameAttributeName a string containing the name of the root name attribute
+      */
+    CXmlReaderDocSource(const std::string &uri, bool bXIncludes, bool bValidateWithSchema,
+                        const std::string &strRootElementType,
+                        const std::string &strRootElementName = "",
+                        const std::string &strNameAttributeName = "");
+
+    ~CXmlReaderDocSource() override;
+
+    /**
+      * Read the document up to its root element and check it.
+      *
+      * Only the root element attributes are available afterwards, its children are read by
+      * processChildren.
+      *
+      * @param[out] serializingContext is used as error output
+      *
+      * @return false if there are any error
+      */
+    bool populate(CXmlSerializingContext &serializingContext) override;
+
+    bool isParsable() const override;
+
+    /**
+      * Read and process the root element children, one at a time.
+      *
+      * Each child is read with its XIncludes resolved, validated and processed, then freed before
+      * the next one is read.
+      *
+      * @param[in] process called with each child element, stops the reading if returning false
+      * @param[out] serializingContext is used as error output
+      *
+      * @return false if a child could not be read, validated or processed, true otherwise
+      */
+    bool processChildren(const std::function<bool(const CXmlElement &)> &process,
+                         CXmlSerializingContext &serializingContext);
+
+private:
+    /** Validate a child against the schema of its element, if required */
+    bool isChildValid(_xmlNode *child, CXmlSerializingContext &serializingContext);
+
+    /** Report a read error */
+    void setReadError(CXmlSerializingContext &serializingContext) const;
+
+    const std::string _uri;
+    const bool _bXIncludes;
+
+    _xmlTextReader *_pReader{nullptr};
+
+    /** Names of the children validated so far */
+    std::set<std::string> _childNames;
+};
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "XmlSchemaCache.h"
+#include <libxml/parser.h>
+#include <libxml/xmlschemas.h>
+
+using std::string;
+
+CXmlSchemaCache &CXmlSchemaCache::getInstance()
+{
+    static CXmlSchemaCache instance;
+    return instance;
+}
+
+CXmlSchemaCache::Schema CXmlSchemaCache::getSchema(const string &schemaUri)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Schema &schema = mSchemas[schemaUri];
+
+    if (schema == nullptr) {
+
+        schema = compile(schemaUri);
+    }
+    return schema;
+}
+
+CXmlSchemaCache::Schema CXmlSchemaCache::compile(const string &schemaUri)
+{
+#ifdef LIBXML_SCHEMAS_ENABLED
+    std::unique_ptr<xmlDoc, decltype(xmlFreeDoc) *> schemaDoc(
+        xmlReadFile(schemaUri.c_str(), NULL, XML_PARSE_NONET), xmlFreeDoc);
+
+    if (schemaDoc == nullptr) {
+        // Unable to load Schema
+        return nullptr;
+    }
+
+    std::unique_ptr<xmlSchemaParserCtxt, decltype(xmlSchemaFreeParserCtxt) *> parserCtxt(
+        xmlSchemaNewDocParserCtxt(schemaDoc.get()), xmlSchemaFreeParserCtxt);
+
+    if (parserCtxt == nullptr) {
+        // Unable to create schema context
+        return nullptr;
+    }
+
+    xmlSchemaPtr schema = xmlSchemaParse(parserCtxt.get());
+
+    if (schema == NULL) {
+        // Invalid Schema
+        return nullptr;
+    }
+    // The schema may refer to its document, keep it as long as the schema
+    xmlDocPtr doc = schemaDoc.release();
+
+    return Schema(schema, [doc](xmlSchemaPtr compiled) {
+        xmlSchemaFree(compiled);
+        xmlFreeDoc(doc);
+    });
+#else
+    return nullptr;
+#endif
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+struct _xmlSchema;
+
+/** Process-wide cache of the compiled XML Schemas
+ *
+ * Compiled schemas are immutable: they may be used concurrently, each validation using its own
+ * validation context.
+ *
+ * A schema is compiled once per process and kept until the process ends: a schema file changed
+ * or removed afterwards is not read again, restart the process to use the new schemas.
+ */
+class CXmlSchemaCache : private utility::NonCopyable
+{
+public:
+    using Schema = std::shared_ptr<_xmlSchema>;
+
+    static CXmlSchemaCache &getInstance();
+
+    /** Get the compiled schema of an URI, compiling it on first use
+     *
+     * A schema failing to compile is not cached, it is compiled again on next use. A compiled
+     * schema is never reloaded, even if its file changes.
+     *
+     * @param[in] schemaUri the URI of the schema
+     * @return the compiled schema, NULL if it could not be read or compiled
+     */
+    Schema getSchema(const std::string &schemaUri);
+
+private:
+    CXmlSchemaCache() = default;
+
+    static Schema compile(const std::string &schemaUri);
+
+    std::mutex mMutex;
+    std::map<std::string, Schema> mSchemas;
+};